@@ -1,10 +1,11 @@
 using UnityEngine;
 using System.Collections.Generic;
-using System.Linq;
 
 /// <summary>
 /// Manages the overall stitching procedure for the medical operation
 /// Tracks progress, handles completion, and coordinates between stitch sites
+/// Procedure state lives in a StitchProcedureLog: each site gets a stable integer id (its index
+/// in stitchSites), every action is appended to the log, and progress queries read its counters.
 /// </summary>
 public class StitchManager : MonoBehaviour
 {
@@ -27,13 +28,8 @@ public class StitchManager : MonoBehaviour
     public UnityEngine.UI.Text timerText;
     
     // Private variables
-    private int completedStitches = 0;
-    private float startTime;
-    private bool procedureCompleted = false;
+    private readonly StitchProcedureLog procedureLog = new StitchProcedureLog();
     private AudioSource audioSource;
-    private float lastStitchTime = -999f; // Time when last stitch was completed
-    private bool isStitchingInProgress = false; // Prevents multiple simultaneous stitches
-    private HashSet<StitchSite> completedSites = new HashSet<StitchSite>(); // Track which sites have been completed
     
     // Events
     public System.Action OnProcedureStarted;
@@ -41,6 +37,11 @@ public class StitchManager : MonoBehaviour
     public System.Action<StitchSite> OnStitchCompleted; // Event for individual stitch completions
     public System.Action<float> OnProgressUpdated; // Progress as percentage (0-1)
     
+    /// <summary>
+    /// Every event of the current attempt, for scoring or replay
+    /// </summary>
+    public StitchProcedureLog ProcedureLog => procedureLog;
+    
     private void Awake()
     {
         audioSource = GetComponent<AudioSource>();
@@ -57,7 +58,7 @@ public class StitchManager : MonoBehaviour
     
     private void Update()
     {
-        if (enableTimer && !procedureCompleted)
+        if (enableTimer && !procedureLog.IsProcedureCompleted)
         {
             UpdateTimer();
         }
@@ -71,24 +72,27 @@ public class StitchManager : MonoBehaviour
         // Auto-find stitch sites if not manually assigned
         if (stitchSites.Count == 0)
         {
-            stitchSites = FindObjectsOfType<StitchSite>().ToList();
+            StitchSite[] foundSites = FindObjectsOfType<StitchSite>();
             
             // Sort by name for consistent ordering
-            stitchSites = stitchSites.OrderBy(s => s.name).ToList();
+            System.Array.Sort(foundSites, (a, b) => Comparer<string>.Default.Compare(a.name, b.name));
+            stitchSites.AddRange(foundSites);
         }
         
-        // Subscribe to stitch completion events
+        // Give each site its id and subscribe to stitch completion events
+        procedureLog.Forget();
         foreach (var stitchSite in stitchSites)
         {
+            stitchSite.ProcedureId = procedureLog.RegisterSite();
             stitchSite.OnStitchCompleted += OnStitchSiteCompleted;
         }
         
+        // Record start time
+        procedureLog.Record(StitchProcedureLog.EventType.ProcedureStarted, -1, Time.time);
+        
         // Initialize UI
         UpdateProgressUI();
         
-        // Record start time
-        startTime = Time.time;
-        
         // Trigger start event
         OnProcedureStarted?.Invoke();
         
@@ -100,11 +104,11 @@ public class StitchManager : MonoBehaviour
     /// </summary>
     public bool IsStitchingAllowed()
     {
-        if (procedureCompleted || isStitchingInProgress)
+        if (procedureLog.IsProcedureCompleted || procedureLog.IsStitchInProgress)
             return false;
             
         // Check if enough time has passed since last stitch
-        float timeSinceLastStitch = Time.time - lastStitchTime;
+        float timeSinceLastStitch = Time.time - procedureLog.LastCompletionTime;
         float requiredCooldown = stitchSites.Count > 0 ? stitchSites[0].stitchCooldownTime : 2.0f;
         
         return timeSinceLastStitch >= requiredCooldown;
@@ -115,10 +119,10 @@ public class StitchManager : MonoBehaviour
     /// </summary>
     public float GetRemainingCooldown()
     {
-        if (procedureCompleted)
+        if (procedureLog.IsProcedureCompleted)
             return 0f;
             
-        float timeSinceLastStitch = Time.time - lastStitchTime;
+        float timeSinceLastStitch = Time.time - procedureLog.LastCompletionTime;
         float requiredCooldown = stitchSites.Count > 0 ? stitchSites[0].stitchCooldownTime : 2.0f;
         
         return Mathf.Max(0f, requiredCooldown - timeSinceLastStitch);
@@ -127,9 +131,13 @@ public class StitchManager : MonoBehaviour
     /// <summary>
     /// Mark that a stitch is starting (prevents simultaneous stitches)
     /// </summary>
-    public void SetStitchingInProgress(bool inProgress)
+    public void SetStitchingInProgress(bool inProgress, StitchSite site = null)
     {
-        isStitchingInProgress = inProgress;
+        if (inProgress == procedureLog.IsStitchInProgress)
+            return;
+            
+        var type = inProgress ? StitchProcedureLog.EventType.StitchStarted : StitchProcedureLog.EventType.StitchStopped;
+        procedureLog.Record(type, SiteId(site), Time.time);
     }
     
     /// <summary>
@@ -137,31 +145,28 @@ public class StitchManager : MonoBehaviour
     /// </summary>
     public void OnStitchSiteCompleted(StitchSite completedSite)
     {
-        if (procedureCompleted)
+        if (procedureLog.IsProcedureCompleted)
             return;
             
-        // Check if this site has already been completed
-        if (completedSites.Contains(completedSite))
+        // Record the completion; duplicates and sites this manager doesn't track are rejected
+        int siteId = SiteId(completedSite);
+        if (!procedureLog.Record(StitchProcedureLog.EventType.StitchCompleted, siteId, Time.time))
         {
-            Debug.LogWarning($"StitchSite {completedSite.name} was already completed! Ignoring duplicate completion.");
+            if (procedureLog.IsCompleted(siteId))
+                Debug.LogWarning($"StitchSite {completedSite.name} was already completed! Ignoring duplicate completion.");
+            else
+                Debug.LogWarning($"StitchSite {(completedSite != null ? completedSite.name : "null")} is not part of this procedure. Ignoring completion.");
             return;
         }
         
-        // Add to completed sites list
-        completedSites.Add(completedSite);
-        
-        completedStitches++;
-        lastStitchTime = Time.time; // Record when this stitch was completed
-        isStitchingInProgress = false; // Clear the in-progress flag
-        
+        int completedStitches = procedureLog.CompletedCount;
         Debug.Log($"Stitch completed: {completedSite.name} ({completedStitches}/{stitchSites.Count})");
         
         // Trigger stitch completion event for other systems (like video manager)
         OnStitchCompleted?.Invoke(completedSite);
         
         // Update progress
-        float progress = (float)completedStitches / stitchSites.Count;
-        OnProgressUpdated?.Invoke(progress);
+        OnProgressUpdated?.Invoke(procedureLog.Progress);
         UpdateProgressUI();
         
         // Check if procedure is complete
@@ -181,6 +186,7 @@ public class StitchManager : MonoBehaviour
     /// </summary>
     private void EnableNextStitchSite()
     {
+        int completedStitches = procedureLog.CompletedCount;
         if (completedStitches < stitchSites.Count)
         {
             var nextSite = stitchSites[completedStitches];
@@ -194,8 +200,8 @@ public class StitchManager : MonoBehaviour
     /// </summary>
     private void CompleteProcedure()
     {
-        procedureCompleted = true;
-        float completionTime = Time.time - startTime;
+        procedureLog.Record(StitchProcedureLog.EventType.ProcedureCompleted, -1, Time.time);
+        float completionTime = Time.time - procedureLog.StartTime;
         
         Debug.Log($"Procedure completed in {completionTime:F1} seconds!");
         
@@ -226,16 +232,14 @@ public class StitchManager : MonoBehaviour
     /// </summary>
     private void UpdateProgressUI()
     {
-        float progress = (float)completedStitches / stitchSites.Count;
-        
         if (progressSlider != null)
         {
-            progressSlider.value = progress;
+            progressSlider.value = procedureLog.Progress;
         }
         
         if (progressText != null)
         {
-            progressText.text = $"Stitches: {completedStitches}/{stitchSites.Count}";
+            progressText.text = $"Stitches: {procedureLog.CompletedCount}/{stitchSites.Count}";
         }
     }
     
@@ -244,7 +248,7 @@ public class StitchManager : MonoBehaviour
     /// </summary>
     private void UpdateTimer()
     {
-        float elapsedTime = Time.time - startTime;
+        float elapsedTime = Time.time - procedureLog.StartTime;
         float remainingTime = Mathf.Max(0, procedureTimeLimit - elapsedTime);
         
         if (timerText != null)
@@ -255,7 +259,7 @@ public class StitchManager : MonoBehaviour
         }
         
         // Check if time limit exceeded
-        if (remainingTime <= 0 && !procedureCompleted)
+        if (remainingTime <= 0 && !procedureLog.IsProcedureCompleted && !procedureLog.IsTimeUp)
         {
             OnTimeUp();
         }
@@ -266,6 +270,7 @@ public class StitchManager : MonoBehaviour
     /// </summary>
     private void OnTimeUp()
     {
+        procedureLog.Record(StitchProcedureLog.EventType.TimeUp, -1, Time.time);
         Debug.Log("Time limit reached!");
         // Handle time up scenario (restart, show message, etc.)
     }
@@ -275,9 +280,6 @@ public class StitchManager : MonoBehaviour
     /// </summary>
     public void ResetProcedure()
     {
-        procedureCompleted = false;
-        completedStitches = 0;
-        
         // Reset all stitch sites
         foreach (var stitchSite in stitchSites)
         {
@@ -290,11 +292,9 @@ public class StitchManager : MonoBehaviour
             procedureCompleteUI.SetActive(false);
         }
         
-        // Reset timer
-        startTime = Time.time;
-        lastStitchTime = -999f; // Reset cooldown timer
-        isStitchingInProgress = false; // Clear in-progress flag
-        completedSites.Clear(); // Clear completed sites list
+        // Truncate the log (clears progress, cooldown and in-progress flag) and restart the timer
+        procedureLog.Clear();
+        procedureLog.Record(StitchProcedureLog.EventType.ProcedureStarted, -1, Time.time);
         
         // Trigger procedure started event (for video manager reset)
         OnProcedureStarted?.Invoke();
@@ -310,7 +310,7 @@ public class StitchManager : MonoBehaviour
     /// </summary>
     public float GetProgress()
     {
-        return (float)completedStitches / stitchSites.Count;
+        return procedureLog.Progress;
     }
     
     /// <summary>
@@ -318,7 +318,7 @@ public class StitchManager : MonoBehaviour
     /// </summary>
     public int GetCompletedStitches()
     {
-        return completedStitches;
+        return procedureLog.CompletedCount;
     }
     
     /// <summary>
@@ -334,6 +334,22 @@ public class StitchManager : MonoBehaviour
     /// </summary>
     public bool IsProcedureCompleted()
     {
-        return procedureCompleted;
+        return procedureLog.IsProcedureCompleted;
+    }
+    
+    /// <summary>
+    /// Check if a particular site has been completed in this attempt
+    /// </summary>
+    public bool IsSiteCompleted(StitchSite site)
+    {
+        return procedureLog.IsCompleted(SiteId(site));
+    }
+    
+    private int SiteId(StitchSite site)
+    {
+        // Ids are indices into stitchSites; anything else is not ours
+        if (site == null || site.ProcedureId < 0 || site.ProcedureId >= stitchSites.Count || stitchSites[site.ProcedureId] != site)
+            return -1;
+        return site.ProcedureId;
     }
 }
@@ -0,0 +1,175 @@
+using System;
+
+/// <summary>
+/// Event-sourced state of a stitching procedure. Every action is appended to a compact in-memory
+/// log and the counters behind progress queries are updated as it goes, so the queries are O(1)
+/// and the exact event stream stays available for scoring or replay.
+/// Sites are identified by the integer id they were registered with. Clear truncates the log and
+/// bumps an epoch instead of touching per-site state, so a reset costs the same for any number of sites.
+/// Holds no Unity objects; times are whatever clock the caller records with.
+/// </summary>
+public sealed class StitchProcedureLog
+{
+    public enum EventType : byte
+    {
+        ProcedureStarted,
+        StitchStarted,   // A tool reached a site and its thread is being drawn
+        StitchStopped,   // The in-progress flag was cleared (finished or cut short)
+        StitchCompleted,
+        ProcedureCompleted,
+        TimeUp
+    }
+
+    public struct Event
+    {
+        public float time;
+        public EventType type;
+        public short site; // -1 when the event isn't about a site
+    }
+
+    private Event[] events = new Event[64];
+    private int eventCount = 0;
+
+    private int[] completedEpoch = new int[16]; // A site is complete when its entry matches epoch
+    private int siteCount = 0;
+    private int epoch = 1;
+    private int completedCount = 0;
+    private float startTime = 0f;
+    private float lastCompletionTime = float.NegativeInfinity;
+    private bool stitchInProgress = false;
+    private bool procedureCompleted = false;
+    private bool timeUp = false;
+
+    public int SiteCount => siteCount;
+    public int CompletedCount => completedCount;
+    public float Progress => siteCount > 0 ? (float)completedCount / siteCount : 0f;
+    public bool IsProcedureCompleted => procedureCompleted;
+    public bool IsStitchInProgress => stitchInProgress;
+    public bool IsTimeUp => timeUp;
+    public float StartTime => startTime;
+    public float LastCompletionTime => lastCompletionTime;
+    public int EventCount => eventCount;
+
+    /// <summary>
+    /// Give a site the next stable id. Ids are never reused until Forget.
+    /// </summary>
+    public int RegisterSite()
+    {
+        if (siteCount == short.MaxValue)
+        {
+            UnityEngine.Debug.LogError("StitchProcedureLog: too many stitch sites");
+            return -1;
+        }
+        if (siteCount == completedEpoch.Length)
+            Array.Resize(ref completedEpoch, completedEpoch.Length * 2);
+        completedEpoch[siteCount] = 0;
+        return siteCount++;
+    }
+
+    public bool IsCompleted(int site)
+    {
+        return site >= 0 && site < siteCount && completedEpoch[site] == epoch;
+    }
+
+    /// <summary>
+    /// Append an event and apply it. Returns false, without logging, for a completion of a site
+    /// that is unknown or already complete.
+    /// </summary>
+    public bool Record(EventType type, int site, float time)
+    {
+        if (type == EventType.StitchCompleted && (site < 0 || site >= siteCount || completedEpoch[site] == epoch))
+            return false;
+
+        if (eventCount == events.Length)
+            Array.Resize(ref events, events.Length * 2);
+        events[eventCount++] = new Event { time = time, type = type, site = (short)site };
+        Apply(type, site, time);
+        return true;
+    }
+
+    public Event GetEvent(int index)
+    {
+        return events[index];
+    }
+
+    /// <summary>
+    /// Copy the log into buffer (grown if needed); returns the number of events
+    /// </summary>
+    public int CopyEvents(ref Event[] buffer)
+    {
+        if (buffer == null || buffer.Length < eventCount)
+            buffer = new Event[eventCount];
+        Array.Copy(events, buffer, eventCount);
+        return eventCount;
+    }
+
+    /// <summary>
+    /// Truncate the log and forget all progress; registered sites keep their ids
+    /// </summary>
+    public void Clear()
+    {
+        eventCount = 0;
+        epoch++;
+        ResetCounters();
+    }
+
+    /// <summary>
+    /// Truncate the log to its first count events and rebuild the state they describe
+    /// </summary>
+    public void TruncateTo(int count)
+    {
+        count = Math.Max(0, Math.Min(count, eventCount));
+        eventCount = count;
+        epoch++;
+        ResetCounters();
+        for (int i = 0; i < count; i++)
+            Apply(events[i].type, events[i].site, events[i].time);
+    }
+
+    /// <summary>
+    /// Drop the sites as well as the log (before registering a new set)
+    /// </summary>
+    public void Forget()
+    {
+        Clear();
+        siteCount = 0;
+    }
+
+    private void ResetCounters()
+    {
+        completedCount = 0;
+        startTime = 0f;
+        lastCompletionTime = float.NegativeInfinity;
+        stitchInProgress = false;
+        procedureCompleted = false;
+        timeUp = false;
+    }
+
+    private void Apply(EventType type, int site, float time)
+    {
+        switch (type)
+        {
+            case EventType.ProcedureStarted:
+                startTime = time;
+                break;
+            case EventType.StitchStarted:
+                stitchInProgress = true;
+                break;
+            case EventType.StitchStopped:
+                stitchInProgress = false;
+                break;
+            case EventType.StitchCompleted:
+                completedEpoch[site] = epoch;
+                completedCount++;
+                lastCompletionTime = time;
+                stitchInProgress = false;
+                break;
+            case EventType.ProcedureCompleted:
+                procedureCompleted = true;
+                break;
+            case EventType.TimeUp:
+                timeUp = true;
+                break;
+        }
+    }
+}
@@ -0,0 +1,399 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+/// <summary>
+/// Central proximity detection between stitch points and tool tips, without physics objects.
+/// Stitch points live in a uniform spatial hash; each frame the few registered tool tips look up
+/// only the cells around them. A tool enters a point's zone inside its radius and leaves only
+/// beyond radius * exitRadiusScale, so a tip resting on the boundary doesn't flicker.
+/// Entry tests the whole path the tip swept since last frame, so a fast flick can't skip a point.
+/// </summary>
+[DefaultExecutionOrder(-20)]
+public class StitchProximitySystem : MonoBehaviour
+{
+    [Header("Spatial Hash")]
+    public float cellSize = 0.1f; // Roughly twice the usual detection radius
+
+    [Header("Hysteresis")]
+    public float exitRadiusScale = 1.25f;
+
+    [Header("Sweep")]
+    public float maxSweepDistance = 0.5f; // Longer tip moves in one frame are teleports and aren't swept
+
+    public delegate void ProximityHandler(int point, VRStitchTool tool);
+
+    private static StitchProximitySystem instance;
+
+    private struct Point
+    {
+        public Transform transform;
+        public Vector3 position;
+        public long cell;
+        public float radius;
+        public int layerMask;
+        public bool enabled;
+        public bool inUse;
+        public int generation; // Tells a reused slot from the point that held it before
+        public ProximityHandler onEnter;
+        public ProximityHandler onExit;
+    }
+
+    private struct Contact
+    {
+        public int point;
+        public int generation;
+        public VRStitchTool tool;
+    }
+
+    private Point[] points = new Point[64];
+    private int pointCount = 0;
+    private readonly Stack<int> freePoints = new Stack<int>();
+    private readonly Dictionary<long, List<int>> cells = new Dictionary<long, List<int>>();
+    private readonly Stack<List<int>> spareCells = new Stack<List<int>>();
+    private float maxRadius = 0f;
+    private int nextGeneration = 1;
+
+    private readonly List<VRStitchTool> tools = new List<VRStitchTool>();
+    private readonly Dictionary<VRStitchTool, Vector3> previousTips = new Dictionary<VRStitchTool, Vector3>();
+    private readonly Dictionary<VRStitchTool, int> toolContactCounts = new Dictionary<VRStitchTool, int>();
+    private readonly List<Contact> contacts = new List<Contact>();
+    private readonly List<Contact> entered = new List<Contact>();
+    private readonly List<Contact> exited = new List<Contact>();
+    private readonly List<Contact> removed = new List<Contact>();
+
+    public static StitchProximitySystem Instance
+    {
+        get
+        {
+            if (instance == null)
+            {
+                instance = FindObjectOfType<StitchProximitySystem>();
+                if (instance == null)
+                {
+                    instance = new GameObject("StitchProximitySystem").AddComponent<StitchProximitySystem>();
+                }
+            }
+            return instance;
+        }
+    }
+
+    public static bool HasInstance => instance != null;
+
+    private void Awake()
+    {
+        if (instance == null)
+        {
+            instance = this;
+        }
+        else if (instance != this)
+        {
+            Debug.LogWarning("Multiple StitchProximitySystem instances found. Using the first one.");
+        }
+    }
+
+    private void OnDestroy()
+    {
+        if (instance == this)
+        {
+            instance = null;
+        }
+    }
+
+    /// <summary>
+    /// Track a stitch point. Handlers run when a tool on a layer in layerMask enters or leaves it.
+    /// Returns the handle for SetEnabled and Unregister.
+    /// </summary>
+    public int Register(Transform point, float radius, LayerMask layerMask, ProximityHandler onEnter, ProximityHandler onExit = null)
+    {
+        int handle;
+        if (freePoints.Count > 0)
+        {
+            handle = freePoints.Pop();
+        }
+        else
+        {
+            if (pointCount == points.Length)
+                System.Array.Resize(ref points, points.Length * 2);
+            handle = pointCount++;
+        }
+
+        Vector3 position = point.position;
+        points[handle] = new Point
+        {
+            transform = point,
+            position = position,
+            cell = CellKey(position),
+            radius = radius,
+            layerMask = layerMask.value,
+            enabled = true,
+            inUse = true,
+            generation = nextGeneration++,
+            onEnter = onEnter,
+            onExit = onExit
+        };
+        AddToCell(points[handle].cell, handle);
+        maxRadius = Mathf.Max(maxRadius, radius);
+        return handle;
+    }
+
+    public void Unregister(int handle)
+    {
+        if (handle < 0 || handle >= pointCount || !points[handle].inUse)
+            return;
+
+        // Contacts are dropped without exit events; the owner is going away
+        for (int i = contacts.Count - 1; i >= 0; i--)
+        {
+            if (contacts[i].point == handle)
+            {
+                ReleaseTool(contacts[i].tool);
+                contacts.RemoveAt(i);
+            }
+        }
+
+        RemoveFromCell(points[handle].cell, handle);
+        points[handle] = default;
+        freePoints.Push(handle);
+    }
+
+    /// <summary>
+    /// Disabled points never fire enter; tools already inside get an exit on the next update
+    /// </summary>
+    public void SetEnabled(int handle, bool enabled)
+    {
+        if (handle >= 0 && handle < pointCount && points[handle].inUse)
+            points[handle].enabled = enabled;
+    }
+
+    public void AddTool(VRStitchTool tool)
+    {
+        if (tool != null && !tools.Contains(tool))
+            tools.Add(tool);
+    }
+
+    /// <summary>
+    /// Stop tracking a tool; the points it was inside get their exit now
+    /// </summary>
+    public void RemoveTool(VRStitchTool tool)
+    {
+        tools.Remove(tool);
+        previousTips.Remove(tool);
+
+        int start = removed.Count; // A handler may remove another tool while these run
+        for (int i = contacts.Count - 1; i >= 0; i--)
+        {
+            if (contacts[i].tool == tool)
+            {
+                removed.Add(contacts[i]);
+                contacts.RemoveAt(i);
+            }
+        }
+        int end = removed.Count;
+        if (toolContactCounts.Remove(tool) && tool != null)
+            tool.SetNearStitchSite(false);
+
+        // Handlers may unregister points, so they run once the tool's contacts are gone
+        for (int i = start; i < end; i++)
+        {
+            Contact contact = removed[i];
+            if (IsCurrent(contact))
+                points[contact.point].onExit?.Invoke(contact.point, contact.tool);
+        }
+        removed.RemoveRange(start, removed.Count - start);
+    }
+
+    private void Update()
+    {
+        RefreshPoints();
+        FindExits();
+        FindEnters();
+
+        // Handlers may register, unregister or disable points, so they run after the scan
+        // and each queued event is checked against what earlier handlers left behind
+        foreach (Contact contact in exited)
+        {
+            ReleaseTool(contact.tool);
+            if (IsCurrent(contact))
+                points[contact.point].onExit?.Invoke(contact.point, contact.tool);
+        }
+        foreach (Contact contact in entered)
+        {
+            // Gone if its point was unregistered or its tool removed since the scan
+            if (contact.tool == null || !IsCurrent(contact) || !HasContact(contact.point, contact.tool))
+                continue;
+            points[contact.point].onEnter?.Invoke(contact.point, contact.tool);
+        }
+        exited.Clear();
+        entered.Clear();
+    }
+
+    /// <summary>
+    /// Stitch points rarely move, so only transforms that changed are rehashed
+    /// </summary>
+    private void RefreshPoints()
+    {
+        for (int i = 0; i < pointCount; i++)
+        {
+            ref Point point = ref points[i];
+            if (!point.inUse || point.transform == null || !point.transform.hasChanged)
+                continue;
+
+            point.transform.hasChanged = false;
+            point.position = point.transform.position;
+            long cell = CellKey(point.position);
+            if (cell != point.cell)
+            {
+                RemoveFromCell(point.cell, i);
+                AddToCell(cell, i);
+                point.cell = cell;
+            }
+        }
+    }
+
+    private void FindExits()
+    {
+        for (int i = contacts.Count - 1; i >= 0; i--)
+        {
+            Contact contact = contacts[i];
+            Point point = points[contact.point];
+            bool inside = false;
+            if (point.enabled && contact.tool != null && contact.tool.isActiveAndEnabled)
+            {
+                float exitRadius = point.radius * exitRadiusScale;
+                inside = (contact.tool.TipPosition - point.position).sqrMagnitude <= exitRadius * exitRadius;
+            }
+
+            if (!inside)
+            {
+                contacts.RemoveAt(i);
+                exited.Add(contact);
+            }
+        }
+    }
+
+    private void FindEnters()
+    {
+        float size = Mathf.Max(cellSize, 1e-4f);
+        int reach = Mathf.CeilToInt(maxRadius / size);
+
+        for (int t = 0; t < tools.Count; t++)
+        {
+            VRStitchTool tool = tools[t];
+            if (tool == null || !tool.isActiveAndEnabled)
+                continue;
+
+            Vector3 tip = tool.TipPosition;
+            if (!previousTips.TryGetValue(tool, out Vector3 from) || (tip - from).sqrMagnitude > maxSweepDistance * maxSweepDistance)
+                from = tip;
+            previousTips[tool] = tip;
+
+            Vector3 path = tip - from;
+            float pathSqr = path.sqrMagnitude;
+            int layerBit = 1 << tool.gameObject.layer;
+            Vector3 low = Vector3.Min(from, tip);
+            Vector3 high = Vector3.Max(from, tip);
+
+            for (int x = Mathf.FloorToInt(low.x / size) - reach; x <= Mathf.FloorToInt(high.x / size) + reach; x++)
+            for (int y = Mathf.FloorToInt(low.y / size) - reach; y <= Mathf.FloorToInt(high.y / size) + reach; y++)
+            for (int z = Mathf.FloorToInt(low.z / size) - reach; z <= Mathf.FloorToInt(high.z / size) + reach; z++)
+            {
+                if (!cells.TryGetValue(PackCell(x, y, z), out List<int> cell))
+                    continue;
+
+                foreach (int index in cell)
+                {
+                    Point point = points[index];
+                    if (!point.enabled || (point.layerMask & layerBit) == 0)
+                        continue;
+                    // Closest approach of the swept path to the point
+                    float along = pathSqr > 1e-12f ? Mathf.Clamp01(Vector3.Dot(point.position - from, path) / pathSqr) : 1f;
+                    if ((from + path * along - point.position).sqrMagnitude > point.radius * point.radius)
+                        continue;
+                    if (HasContact(index, tool))
+                        continue;
+
+                    // Counted as soon as it exists, so Unregister and RemoveTool can release it before its enter runs
+                    Contact contact = new Contact { point = index, generation = point.generation, tool = tool };
+                    contacts.Add(contact);
+                    entered.Add(contact);
+                    AcquireTool(tool);
+                }
+            }
+        }
+    }
+
+    private bool HasContact(int point, VRStitchTool tool)
+    {
+        foreach (Contact contact in contacts)
+        {
+            if (contact.point == point && contact.tool == tool)
+                return true;
+        }
+        return false;
+    }
+
+    private bool IsCurrent(Contact contact)
+    {
+        return points[contact.point].inUse && points[contact.point].generation == contact.generation;
+    }
+
+    private void AcquireTool(VRStitchTool tool)
+    {
+        if (!toolContactCounts.TryGetValue(tool, out int count))
+            count = 0;
+        toolContactCounts[tool] = count + 1;
+        if (count == 0)
+            tool.SetNearStitchSite(true);
+    }
+
+    private void ReleaseTool(VRStitchTool tool)
+    {
+        if (tool == null || !toolContactCounts.TryGetValue(tool, out int count))
+            return;
+
+        if (count <= 1)
+        {
+            toolContactCounts.Remove(tool);
+            tool.SetNearStitchSite(false);
+        }
+        else
+        {
+            toolContactCounts[tool] = count - 1;
+        }
+    }
+
+    private long CellKey(Vector3 position)
+    {
+        float size = Mathf.Max(cellSize, 1e-4f);
+        return PackCell(Mathf.FloorToInt(position.x / size), Mathf.FloorToInt(position.y / size), Mathf.FloorToInt(position.z / size));
+    }
+
+    // 21 bits per axis covers +/-100 km at 10 cm cells
+    private static long PackCell(int x, int y, int z)
+    {
+        return ((long)(x & 0x1FFFFF) << 42) | ((long)(y & 0x1FFFFF) << 21) | (long)(z & 0x1FFFFF);
+    }
+
+    private void AddToCell(long key, int index)
+    {
+        if (!cells.TryGetValue(key, out List<int> cell))
+        {
+            cell = spareCells.Count > 0 ? spareCells.Pop() : new List<int>(4);
+            cells[key] = cell;
+        }
+        cell.Add(index);
+    }
+
+    private void RemoveFromCell(long key, int index)
+    {
+        if (!cells.TryGetValue(key, out List<int> cell))
+            return;
+
+        cell.Remove(index);
+        if (cell.Count == 0)
+        {
+            cells.Remove(key);
+            spareCells.Push(cell);
+        }
+    }
+}
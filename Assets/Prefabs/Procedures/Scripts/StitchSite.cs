@@ -22,10 +22,13 @@ public class StitchSite : MonoBehaviour
     public float threadHeightOffset = 0.01f; // 1cm above the stitch points
     public AnimationCurve threadCreationCurve = AnimationCurve.EaseInOut(0, 0, 1, 1);
     public float threadCreationDuration = 1.0f;
+    public bool useTubeMesh = true; // Round mesh tube with distance LOD instead of a flat LineRenderer ribbon
 
     [Header("Skin Deformation Settings")]
     public Transform leftSkinObject; // Left skin segment
     public Transform rightSkinObject; // Right skin segment
+    [Tooltip("Skin meshes whose wound edges are pulled together around this stitch; when set they replace the skin object lerps")]
+    public WoundEdgeDeformer[] woundDeformers;
 
     [Header("Skin Initial Positioning")]
     [Tooltip("Offset from the first stitch where left skin starts")]
@@ -63,11 +66,16 @@ public class StitchSite : MonoBehaviour
     public AudioClip stitchCompleteSound;
 
     // Private variables
+    private GameObject threadObject;
     private LineRenderer threadLineRenderer;
+    private ThreadTubeMesh threadTube;
+    private readonly Vector3[] threadEnds = new Vector3[2];
     private bool isStitched = false;
     private bool isCreatingThread = false;
     private AudioSource audioSource;
     private StitchManager stitchManager;
+    private int firstProximityHandle = -1;
+    private int secondProximityHandle = -1;
 
     // Skin positioning tracking
     private Vector3 leftSkinFinalPosition; // Where left skin should end up (current Inspector position)
@@ -79,16 +87,53 @@ public class StitchSite : MonoBehaviour
     private bool leftSkinActivated = false;
     private bool rightSkinActivated = false;
     private bool isSliding = false; // Track if skins are currently sliding
+    private int[] woundHandles; // One per woundDeformers entry, -1 when not anchored
 
     // StitchVisualizer management
     private Renderer[] visualizerRenderers; // Cache renderers for fade effect
+    private int visualizerGroup = -1; // RendererOverrideSystem group that fades them
     private bool visualizerShown = false;
+    private System.Action visualizerShownCallback;
+
+    // Animations run on the TweenSystem; delegates are cached so starting one allocates nothing
+    private System.Action onSkinSlid;
+    private System.Action startStitchingAfterSlide;
+    private System.Action<float> growThread;
+    private System.Action onThreadGrown;
+    private System.Action onSkinPulled;
+    private System.Action onStitchStepDone;
+    private System.Action<float> setWoundTension;
+    private System.Action activateVisualizer;
+    private System.Action onVisualizerFaded;
+    private System.Action completeStitch;
+    private int leftSkinTween, rightSkinTween, threadTween, woundTween, visualizerTween, delayTween;
+    private int pendingStitchSteps = 0; // Thread growth and skin animation both finish before the visualizer shows
+    private Vector3 threadStartPosition;
+    private Vector3 threadEndPosition;
+    private Vector3 leftSkinPulledPosition;
+    private Vector3 rightSkinPulledPosition;
+
+    /// <summary>
+    /// Stable id assigned by the StitchManager for its procedure log (-1 when unmanaged)
+    /// </summary>
+    public int ProcedureId { get; set; } = -1;
 
     // Events
     public System.Action<StitchSite> OnStitchCompleted;
 
     private void Awake()
     {
+        onSkinSlid = OnSkinSlid;
+        startStitchingAfterSlide = StartStitchingAfterSlide;
+        growThread = GrowThread;
+        onThreadGrown = OnThreadGrown;
+        onSkinPulled = OnSkinPulled;
+        onStitchStepDone = OnStitchStepDone;
+        setWoundTension = SetWoundTension;
+        activateVisualizer = ActivateVisualizer;
+        onVisualizerFaded = OnVisualizerFaded;
+        completeStitch = CompleteStitch;
+
         // Validate stitch points
         if (firstStitch == null || secondStitch == null)
         {
@@ -143,6 +188,7 @@ public class StitchSite : MonoBehaviour
 
         // Cache all renderers in the visualizer for fade effects
         visualizerRenderers = stitchVisualizer.GetComponentsInChildren<Renderer>();
+        visualizerGroup = RendererOverrideSystem.Instance.CreateGroup(visualizerRenderers);
 
         // Hide the visualizer initially
         stitchVisualizer.SetActive(false);
@@ -182,37 +228,42 @@ public class StitchSite : MonoBehaviour
 
     private void Start()
     {
-        // Create sphere colliders for detection if they don't exist
-        CreateDetectionColliders();
+        RegisterDetectionPoints();
     }
 
-    private void CreateDetectionColliders()
+    private void OnDestroy()
     {
-        // Create detection collider at FirstStitch
-        CreateDetectionColliderAt(firstStitch, "FirstStitchDetector");
-
-        // Create detection collider at SecondStitch  
-        CreateDetectionColliderAt(secondStitch, "SecondStitchDetector");
+        if (StitchProximitySystem.HasInstance)
+        {
+            StitchProximitySystem.Instance.Unregister(firstProximityHandle);
+            StitchProximitySystem.Instance.Unregister(secondProximityHandle);
+        }
+        firstProximityHandle = secondProximityHandle = -1;
+        ReleaseWoundAnchors();
+        KillTweens();
+        if (RendererOverrideSystem.HasInstance)
+            RendererOverrideSystem.Instance.DestroyGroup(visualizerGroup);
+        visualizerGroup = -1;
     }
 
-    private void CreateDetectionColliderAt(Transform stitchPoint, string colliderName)
+    private void RegisterDetectionPoints()
     {
-        GameObject detectorObj = new GameObject(colliderName);
-        detectorObj.transform.SetParent(stitchPoint);
-        detectorObj.transform.localPosition = Vector3.zero;
+        if (firstStitch == null || secondStitch == null)
+            return;
 
-        SphereCollider detector = detectorObj.AddComponent<SphereCollider>();
-        detector.radius = detectionRadius;
-        detector.isTrigger = true;
+        // Proximity is tested centrally against the tracked tool tips; no colliders per site
+        StitchProximitySystem proximity = StitchProximitySystem.Instance;
+        firstProximityHandle = proximity.Register(firstStitch, detectionRadius, toolLayerMask, OnToolEnteredPoint);
+        secondProximityHandle = proximity.Register(secondStitch, detectionRadius, toolLayerMask, OnToolEnteredPoint);
+    }
 
-        // Add the detector component
-        StitchDetector detectorScript = detectorObj.AddComponent<StitchDetector>();
-        detectorScript.parentStitchSite = this;
-        detectorScript.toolLayerMask = toolLayerMask;
+    private void OnToolEnteredPoint(int point, VRStitchTool tool)
+    {
+        HandleToolAtStitch(point == firstProximityHandle ? firstStitch : secondStitch);
     }
 
     /// <summary>
-    /// Called by StitchDetector when a tool enters the detection zone
+    /// Report a tool in the detection zone from outside the proximity system
     /// </summary>
     public void OnToolDetected(GameObject tool)
     {
@@ -222,8 +273,11 @@ public class StitchSite : MonoBehaviour
             return;
 
         // Determine which stitch was detected based on tool position
-        Transform detectedStitch = GetClosestStitch(tool.transform.position);
+        HandleToolAtStitch(GetClosestStitch(stitchTool.TipPosition));
+    }
 
+    private void HandleToolAtStitch(Transform detectedStitch)
+    {
         // Show skin for the detected stitch
         ShowSkinForStitch(detectedStitch);
 
@@ -252,7 +306,7 @@ public class StitchSite : MonoBehaviour
             }
             leftSkinActivated = true;
             Vector3 targetPos = firstStitch.position + skinToStitchOffset;
-            StartCoroutine(SlideSkinToStitch(leftSkinObject, leftSkinStartPosition, targetPos, true));
+            SlideSkinToStitch(leftSkinObject, leftSkinStartPosition, targetPos, true);
             Debug.Log($"Sliding left skin object to first stitch for {gameObject.name}");
         }
         else if (detectedStitch == secondStitch && rightSkinObject != null && !rightSkinActivated)
@@ -263,57 +317,43 @@ public class StitchSite : MonoBehaviour
             }
             rightSkinActivated = true;
             Vector3 targetPos = secondStitch.position + skinToStitchOffset;
-            StartCoroutine(SlideSkinToStitch(rightSkinObject, rightSkinStartPosition, targetPos, false));
+            SlideSkinToStitch(rightSkinObject, rightSkinStartPosition, targetPos, false);
             Debug.Log($"Sliding right skin object to second stitch for {gameObject.name}");
         }
     }
 
-    private System.Collections.IEnumerator SlideSkinToStitch(Transform skinObject, Vector3 startPos, Vector3 targetPos, bool isLeftSkin)
+    private void SlideSkinToStitch(Transform skinObject, Vector3 startPos, Vector3 targetPos, bool isLeftSkin)
     {
-        if (skinObject == null) yield break;
+        if (skinObject == null) return;
 
         isSliding = true;
 
-        // Ensure skin starts at the correct position
-        skinObject.position = startPos;
-
-        float elapsedTime = 0f;
-
-        while (elapsedTime < skinSlideToStitchDuration)
-        {
-            elapsedTime += Time.deltaTime;
-            float progress = skinSlideToStitchCurve.Evaluate(elapsedTime / skinSlideToStitchDuration);
-
-            if (skinObject != null)
-            {
-                skinObject.position = Vector3.Lerp(startPos, targetPos, progress);
-            }
-
-            yield return null;
-        }
+        // Starts at startPos this frame and lands exactly on targetPos
+        int tween = TweenSystem.Instance.Move(skinObject, startPos, targetPos, skinSlideToStitchDuration, skinSlideToStitchCurve, onSkinSlid);
+        if (isLeftSkin)
+            leftSkinTween = tween;
+        else
+            rightSkinTween = tween;
+    }
 
-        // Ensure exact final position
-        if (skinObject != null)
-        {
-            skinObject.position = targetPos;
-        }
+    private void OnSkinSlid()
+    {
+        isSliding = false;
 
         // Check if both skins have finished sliding
         if (leftSkinActivated && rightSkinActivated)
         {
-            isSliding = false;
             // Small delay before starting stitching process
-            yield return new WaitForSeconds(0.2f);
-
-            // Check if we should start stitching (both skins activated and not already stitching)
-            if (!isStitched && !isCreatingThread)
-            {
-                StartStitchingProcess();
-            }
+            delayTween = TweenSystem.Instance.Delay(0.2f, startStitchingAfterSlide);
         }
-        else
+    }
+
+    private void StartStitchingAfterSlide()
+    {
+        // Check if we should start stitching (both skins activated and not already stitching)
+        if (!isStitched && !isCreatingThread)
         {
-            isSliding = false;
+            StartStitchingProcess();
         }
     }
 
@@ -344,92 +384,106 @@ public class StitchSite : MonoBehaviour
         // Mark stitching as in progress to prevent simultaneous stitches
         if (stitchManager != null)
         {
-            stitchManager.SetStitchingInProgress(true);
+            stitchManager.SetStitchingInProgress(true, this);
         }
 
         // Start thread creation with skin animation
-        StartCoroutine(CreateThreadWithSkinAnimation());
+        CreateThreadWithSkinAnimation();
     }
 
-    private System.Collections.IEnumerator CreateThreadWithSkinAnimation()
+    private void CreateThreadWithSkinAnimation()
     {
         isCreatingThread = true;
 
-        // Create LineRenderer for the thread
-        if (threadLineRenderer == null)
+        // Create the thread object
+        if (threadObject == null)
         {
-            GameObject threadObj = new GameObject($"Thread_{gameObject.name}");
-            threadObj.transform.SetParent(transform);
-            threadLineRenderer = threadObj.AddComponent<LineRenderer>();
+            threadObject = new GameObject($"Thread_{gameObject.name}");
+            threadObject.transform.SetParent(transform);
 
-            // Configure LineRenderer
-            threadLineRenderer.material = threadMaterial;
-            threadLineRenderer.startWidth = threadWidth;
-            threadLineRenderer.endWidth = threadWidth;
-            threadLineRenderer.positionCount = 2;
-            threadLineRenderer.useWorldSpace = true;
+            if (useTubeMesh)
+            {
+                threadTube = threadObject.AddComponent<ThreadTubeMesh>();
+                threadTube.radius = threadWidth * 0.5f;
+                threadTube.SetMaterial(threadMaterial);
+            }
+            else
+            {
+                threadLineRenderer = threadObject.AddComponent<LineRenderer>();
+
+                // Configure LineRenderer
+                threadLineRenderer.material = threadMaterial;
+                threadLineRenderer.startWidth = threadWidth;
+                threadLineRenderer.endWidth = threadWidth;
+                threadLineRenderer.positionCount = 2;
+                threadLineRenderer.useWorldSpace = true;
+            }
         }
 
         // Validate that we have all required components before proceeding
-        if (threadLineRenderer == null || firstStitch == null || secondStitch == null)
+        if (threadObject == null || firstStitch == null || secondStitch == null)
         {
             Debug.LogError($"StitchSite {gameObject.name} is missing required components for thread creation!");
             CleanupOnError();
-            yield break;
+            return;
         }
 
         // Start skin animation simultaneously with thread creation
-        Coroutine skinCoroutine = StartCoroutine(AnimateSkinDeformation());
+        pendingStitchSteps = 2;
+        AnimateSkinDeformation();
 
         // Animate thread creation - growing from first stitch to second stitch
-        float elapsedTime = 0f;
-        Vector3 startPos = firstStitch.position + Vector3.up * threadHeightOffset;
-        Vector3 endPos = secondStitch.position + Vector3.up * threadHeightOffset;
+        threadStartPosition = firstStitch.position + Vector3.up * threadHeightOffset;
+        threadEndPosition = secondStitch.position + Vector3.up * threadHeightOffset;
 
         // Initially, both points start at the first stitch (zero-length line)
-        threadLineRenderer.SetPosition(0, startPos);
-        threadLineRenderer.SetPosition(1, startPos);
+        threadTween = TweenSystem.Instance.Value(0f, 1f, threadCreationDuration, growThread, threadCreationCurve, onThreadGrown);
+    }
 
-        while (elapsedTime < threadCreationDuration)
+    private void GrowThread(float progress)
+    {
+        // Safety check - if components were destroyed during animation
+        if (threadObject == null)
         {
-            // Safety check - if components were destroyed during animation
-            if (threadLineRenderer == null)
-            {
-                Debug.LogWarning($"Thread renderer was destroyed during animation on {gameObject.name}");
-                CleanupOnError();
-                yield break;
-            }
-
-            elapsedTime += Time.deltaTime;
-            float progress = threadCreationCurve.Evaluate(elapsedTime / threadCreationDuration);
-
-            // First position always stays at first stitch
-            // Second position grows from first stitch toward second stitch
-            threadLineRenderer.SetPosition(0, startPos);
-            threadLineRenderer.SetPosition(1, Vector3.Lerp(startPos, endPos, progress));
-
-            yield return null;
+            Debug.LogWarning($"Thread renderer was destroyed during animation on {gameObject.name}");
+            KillTweens();
+            CleanupOnError();
+            return;
         }
 
+        // First position always stays at first stitch
+        // Second position grows from first stitch toward second stitch
+        SetThreadEnds(threadStartPosition, Vector3.Lerp(threadStartPosition, threadEndPosition, progress));
+    }
+
+    private void OnThreadGrown()
+    {
         // Ensure final position is exact
-        if (threadLineRenderer != null)
+        if (threadObject != null)
         {
-            threadLineRenderer.SetPosition(0, startPos);
-            threadLineRenderer.SetPosition(1, endPos);
+            SetThreadEnds(threadStartPosition, threadEndPosition);
         }
 
-        // Wait for skin animation to complete
-        yield return skinCoroutine;
+        OnStitchStepDone();
+    }
+
+    private void OnStitchStepDone()
+    {
+        if (--pendingStitchSteps > 0)
+            return;
 
         // Show the StitchVisualizer after skin animation completes
-        yield return StartCoroutine(ShowStitchVisualizer());
+        ShowStitchVisualizer(completeStitch);
+    }
 
+    private void CompleteStitch()
+    {
         // Mark as stitched
         isStitched = true;
         isCreatingThread = false;
 
-        // Disable detection colliders to prevent further stitching
-        DisableDetectionColliders();
+        // Stop tool detection to prevent further stitching
+        DisableToolDetection();
 
         // Play completion sound
         if (stitchCompleteSound != null && audioSource != null)
@@ -440,7 +494,7 @@ public class StitchSite : MonoBehaviour
         // Clear stitching in progress
         if (stitchManager != null)
         {
-            stitchManager.SetStitchingInProgress(false);
+            stitchManager.SetStitchingInProgress(false, this);
         }
 
         // Notify completion
@@ -448,10 +502,19 @@ public class StitchSite : MonoBehaviour
         stitchManager?.OnStitchSiteCompleted(this);
     }
 
-    private System.Collections.IEnumerator AnimateSkinDeformation()
+    private void AnimateSkinDeformation()
     {
+        if (woundDeformers != null && woundDeformers.Length > 0)
+        {
+            AnimateWoundClosure();
+            return;
+        }
+
         if (leftSkinObject == null || rightSkinObject == null)
-            yield break;
+        {
+            OnStitchStepDone();
+            return;
+        }
 
         // Use current positions as starting points (after the slide animation)
         Vector3 leftStartPos = leftSkinObject.position;
@@ -461,71 +524,81 @@ public class StitchSite : MonoBehaviour
         Vector3 centerPoint = (firstStitch.position + secondStitch.position) * 0.5f;
 
         // Calculate target positions - skins move toward each other
-        Vector3 leftTargetPos = Vector3.Lerp(leftStartPos, centerPoint, skinPullStrength);
-        Vector3 rightTargetPos = Vector3.Lerp(rightStartPos, centerPoint, skinPullStrength);
+        leftSkinPulledPosition = Vector3.Lerp(leftStartPos, centerPoint, skinPullStrength);
+        rightSkinPulledPosition = Vector3.Lerp(rightStartPos, centerPoint, skinPullStrength);
 
         // First phase: Pull skins toward each other (simulating tissue being pulled together)
-        float elapsedTime = 0f;
-        while (elapsedTime < skinAnimationDuration)
-        {
-            elapsedTime += Time.deltaTime;
-            float progress = skinMovementCurve.Evaluate(elapsedTime / skinAnimationDuration);
-
-            if (leftSkinObject != null)
-                leftSkinObject.position = Vector3.Lerp(leftStartPos, leftTargetPos, progress);
+        leftSkinTween = TweenSystem.Instance.Move(leftSkinObject, leftStartPos, leftSkinPulledPosition, skinAnimationDuration, skinMovementCurve);
+        rightSkinTween = TweenSystem.Instance.Move(rightSkinObject, rightStartPos, rightSkinPulledPosition, skinAnimationDuration, skinMovementCurve, onSkinPulled);
+    }
 
-            if (rightSkinObject != null)
-                rightSkinObject.position = Vector3.Lerp(rightStartPos, rightTargetPos, progress);
+    private void OnSkinPulled()
+    {
+        // Second phase, after a small delay: Move skins to their final positions (where they were originally placed in Inspector)
+        leftSkinTween = TweenSystem.Instance.Move(leftSkinObject, leftSkinPulledPosition, leftSkinFinalPosition, skinAnimationDuration, skinMovementCurve, null, 0.2f);
+        rightSkinTween = TweenSystem.Instance.Move(rightSkinObject, rightSkinPulledPosition, rightSkinFinalPosition, skinAnimationDuration, skinMovementCurve, onStitchStepDone, 0.2f);
+    }
 
-            yield return null;
+    /// <summary>
+    /// Anchor this stitch in each skin mesh and tighten it; the tissue stays closed until reset
+    /// </summary>
+    private void AnimateWoundClosure()
+    {
+        ReleaseWoundAnchors();
+        woundHandles = new int[woundDeformers.Length];
+        for (int i = 0; i < woundDeformers.Length; i++)
+        {
+            woundHandles[i] = woundDeformers[i] != null
+                ? woundDeformers[i].AddStitch(firstStitch.position, secondStitch.position, skinPullStrength)
+                : -1;
         }
 
-        // Ensure exact positions
-        if (leftSkinObject != null)
-            leftSkinObject.position = leftTargetPos;
-        if (rightSkinObject != null)
-            rightSkinObject.position = rightTargetPos;
-
-        // Small delay before final positioning
-        yield return new WaitForSeconds(0.2f);
+        woundTween = TweenSystem.Instance.Value(0f, 1f, skinAnimationDuration, setWoundTension, skinMovementCurve, onStitchStepDone);
+    }
 
-        // Second phase: Move skins to their final positions (where they were originally placed in Inspector)
-        elapsedTime = 0f;
-        Vector3 leftCurrentPos = leftSkinObject.position;
-        Vector3 rightCurrentPos = rightSkinObject.position;
+    private void SetWoundTension(float tension)
+    {
+        if (woundHandles == null)
+            return;
 
-        while (elapsedTime < skinAnimationDuration)
+        for (int i = 0; i < woundHandles.Length; i++)
         {
-            elapsedTime += Time.deltaTime;
-            float progress = skinMovementCurve.Evaluate(elapsedTime / skinAnimationDuration);
-
-            if (leftSkinObject != null)
-                leftSkinObject.position = Vector3.Lerp(leftCurrentPos, leftSkinFinalPosition, progress);
+            if (woundDeformers[i] != null)
+                woundDeformers[i].SetTension(woundHandles[i], tension);
+        }
+    }
 
-            if (rightSkinObject != null)
-                rightSkinObject.position = Vector3.Lerp(rightCurrentPos, rightSkinFinalPosition, progress);
+    private void ReleaseWoundAnchors()
+    {
+        if (woundHandles == null)
+            return;
 
-            yield return null;
+        for (int i = 0; i < woundHandles.Length; i++)
+        {
+            if (woundDeformers[i] != null)
+                woundDeformers[i].RemoveStitch(woundHandles[i]);
         }
-
-        // Ensure final positions are exact
-        if (leftSkinObject != null)
-            leftSkinObject.position = leftSkinFinalPosition;
-        if (rightSkinObject != null)
-            rightSkinObject.position = rightSkinFinalPosition;
+        woundHandles = null;
     }
 
     /// <summary>
-    /// Show the StitchVisualizer with optional fade-in animation
+    /// Show the StitchVisualizer with optional fade-in animation, then call onShown
     /// </summary>
-    private System.Collections.IEnumerator ShowStitchVisualizer()
+    private void ShowStitchVisualizer(System.Action onShown)
     {
         if (stitchVisualizer == null || visualizerShown)
-            yield break;
+        {
+            onShown?.Invoke();
+            return;
+        }
 
         // Wait for the specified delay
-        yield return new WaitForSeconds(visualizerShowDelay);
+        visualizerShownCallback = onShown;
+        delayTween = TweenSystem.Instance.Delay(visualizerShowDelay, activateVisualizer);
+    }
 
+    private void ActivateVisualizer()
+    {
         // Activate the visualizer
         stitchVisualizer.SetActive(true);
         visualizerShown = true;
@@ -535,54 +608,44 @@ public class StitchSite : MonoBehaviour
         // If we have cached renderers and want a fade-in effect
         if (visualizerRenderers != null && visualizerRenderers.Length > 0 && visualizerFadeInDuration > 0)
         {
-            // Start with transparent materials
-            foreach (var renderer in visualizerRenderers)
-            {
-                if (renderer != null && renderer.material != null)
-                {
-                    // Check if material supports transparency
-                    if (renderer.material.HasProperty("_Color"))
-                    {
-                        Color color = renderer.material.color;
-                        color.a = 0f;
-                        renderer.material.color = color;
-                    }
-                }
-            }
+            // Starts transparent this frame and fades in over time
+            visualizerTween = RendererOverrideSystem.Instance.FadeGroup(visualizerGroup, 0f, 1f, visualizerFadeInDuration, visualizerFadeInCurve, onVisualizerFaded);
+            return;
+        }
 
-            // Fade in over time
-            float elapsedTime = 0f;
-            while (elapsedTime < visualizerFadeInDuration)
-            {
-                elapsedTime += Time.deltaTime;
-                float progress = visualizerFadeInCurve.Evaluate(elapsedTime / visualizerFadeInDuration);
-
-                foreach (var renderer in visualizerRenderers)
-                {
-                    if (renderer != null && renderer.material != null && renderer.material.HasProperty("_Color"))
-                    {
-                        Color color = renderer.material.color;
-                        color.a = progress;
-                        renderer.material.color = color;
-                    }
-                }
-
-                yield return null;
-            }
+        FinishShowingVisualizer();
+    }
 
-            // Ensure full opacity
-            foreach (var renderer in visualizerRenderers)
-            {
-                if (renderer != null && renderer.material != null && renderer.material.HasProperty("_Color"))
-                {
-                    Color color = renderer.material.color;
-                    color.a = 1f;
-                    renderer.material.color = color;
-                }
-            }
-        }
+    private void OnVisualizerFaded()
+    {
+        // Ensure full opacity; at 1 the renderers drop their override and draw from the shared material again
+        RendererOverrideSystem.Instance.SetGroupAlpha(visualizerGroup, 1f);
+        FinishShowingVisualizer();
+    }
 
+    private void FinishShowingVisualizer()
+    {
         Debug.Log($"{gameObject.name}: StitchVisualizer fade-in completed");
+
+        System.Action onShown = visualizerShownCallback;
+        visualizerShownCallback = null;
+        onShown?.Invoke();
+    }
+
+    private void KillTweens()
+    {
+        if (!TweenSystem.HasInstance)
+            return;
+
+        TweenSystem tweens = TweenSystem.Instance;
+        tweens.Kill(leftSkinTween);
+        tweens.Kill(rightSkinTween);
+        tweens.Kill(threadTween);
+        tweens.Kill(woundTween);
+        tweens.Kill(visualizerTween);
+        tweens.Kill(delayTween);
+        pendingStitchSteps = 0;
+        visualizerShownCallback = null;
     }
 
     /// <summary>
@@ -594,10 +657,30 @@ public class StitchSite : MonoBehaviour
         {
             stitchVisualizer.SetActive(false);
             visualizerShown = false;
+            if (RendererOverrideSystem.HasInstance)
+                RendererOverrideSystem.Instance.SetGroupAlpha(visualizerGroup, 1f); // Drop a fade cut short
             Debug.Log($"{gameObject.name}: StitchVisualizer hidden");
         }
     }
 
+    /// <summary>
+    /// Move the thread's two ends, on the tube mesh or the LineRenderer
+    /// </summary>
+    private void SetThreadEnds(Vector3 start, Vector3 end)
+    {
+        if (threadTube != null)
+        {
+            threadEnds[0] = start;
+            threadEnds[1] = end;
+            threadTube.SetPolyline(threadEnds, 2);
+        }
+        else if (threadLineRenderer != null)
+        {
+            threadLineRenderer.SetPosition(0, start);
+            threadLineRenderer.SetPosition(1, end);
+        }
+    }
+
     /// <summary>
     /// Clean up when an error occurs during thread creation
     /// </summary>
@@ -606,42 +689,35 @@ public class StitchSite : MonoBehaviour
         isCreatingThread = false;
         if (stitchManager != null)
         {
-            stitchManager.SetStitchingInProgress(false);
+            stitchManager.SetStitchingInProgress(false, this);
         }
     }
 
     /// <summary>
-    /// Disable detection colliders to prevent further stitching
+    /// Stop detecting tools to prevent further stitching
     /// </summary>
-    private void DisableDetectionColliders()
+    private void DisableToolDetection()
     {
-        // Find and disable all StitchDetector components in children
-        StitchDetector[] detectors = GetComponentsInChildren<StitchDetector>();
-        foreach (StitchDetector detector in detectors)
-        {
-            if (detector != null && detector.gameObject != null)
-            {
-                detector.gameObject.SetActive(false);
-                Debug.Log($"Disabled detection collider for {gameObject.name}");
-            }
-        }
+        SetDetectionEnabled(false);
+        Debug.Log($"Disabled tool detection for {gameObject.name}");
     }
 
     /// <summary>
-    /// Enable detection colliders (used when resetting)
+    /// Detect tools again (used when resetting)
     /// </summary>
-    private void EnableDetectionColliders()
+    private void EnableToolDetection()
     {
-        // Find and enable all StitchDetector components in children
-        StitchDetector[] detectors = GetComponentsInChildren<StitchDetector>(true); // Include inactive
-        foreach (StitchDetector detector in detectors)
-        {
-            if (detector != null && detector.gameObject != null)
-            {
-                detector.gameObject.SetActive(true);
-                Debug.Log($"Enabled detection collider for {gameObject.name}");
-            }
-        }
+        SetDetectionEnabled(true);
+        Debug.Log($"Enabled tool detection for {gameObject.name}");
+    }
+
+    private void SetDetectionEnabled(bool enabled)
+    {
+        if (!StitchProximitySystem.HasInstance)
+            return;
+
+        StitchProximitySystem.Instance.SetEnabled(firstProximityHandle, enabled);
+        StitchProximitySystem.Instance.SetEnabled(secondProximityHandle, enabled);
     }
 
     /// <summary>
@@ -659,22 +735,26 @@ public class StitchSite : MonoBehaviour
     /// </summary>
     public void ResetStitch()
     {
+        KillTweens();
         isStitched = false;
         isCreatingThread = false;
 
-        // Re-enable detection colliders
-        EnableDetectionColliders();
+        // Re-enable tool detection
+        EnableToolDetection();
 
         // Hide the StitchVisualizer
         HideStitchVisualizer();
 
         // Reset skin positions to start positions and hide them again
         InitializeSkinPositions();
+        ReleaseWoundAnchors();
 
-        if (threadLineRenderer != null)
+        if (threadObject != null)
         {
-            DestroyImmediate(threadLineRenderer.gameObject);
+            DestroyImmediate(threadObject);
+            threadObject = null;
             threadLineRenderer = null;
+            threadTube = null;
         }
 
         Debug.Log($"{gameObject.name} reset to initial state");
@@ -719,7 +799,7 @@ public class StitchSite : MonoBehaviour
     {
         if (Application.isPlaying && stitchVisualizer != null)
         {
-            StartCoroutine(ShowStitchVisualizer());
+            ShowStitchVisualizer(null);
         }
     }
 
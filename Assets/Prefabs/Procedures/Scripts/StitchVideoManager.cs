@@ -38,9 +38,14 @@ public class StitchVideoManager : MonoBehaviour
     private Renderer videoRenderer;
     private Material videoMaterial;
     private RenderTexture lastFrame;
+    private Material fadeOutMaterial; // Crossfade targets, read by the cached tween callback
+    private Material fadeInMaterial;
+    private System.Action<float> setCrossfade;
 
     private void Awake()
     {
+        setCrossfade = SetCrossfade;
+
         // Auto-find video player if not assigned
         if (primaryVideoPlayer == null && autoFindVideoPlayer)
         {
@@ -321,36 +326,14 @@ public class StitchVideoManager : MonoBehaviour
 
         if (primaryRenderer != null && secondaryRenderer != null)
         {
-            Material primaryMat = primaryRenderer.material;
-            Material secondaryMat = secondaryRenderer.material;
-
-            // Crossfade
-            float elapsed = 0f;
-            while (elapsed < crossfadeDuration)
-            {
-                elapsed += Time.deltaTime;
-                float t = elapsed / crossfadeDuration;
-
-                // Fade out primary, fade in secondary
-                Color primaryColor = primaryMat.color;
-                Color secondaryColor = secondaryMat.color;
+            fadeOutMaterial = primaryRenderer.material;
+            fadeInMaterial = secondaryRenderer.material;
 
-                primaryColor.a = 1f - t;
-                secondaryColor.a = t;
-
-                primaryMat.color = primaryColor;
-                secondaryMat.color = secondaryColor;
-
-                yield return null;
-            }
+            // Crossfade; the last step lands exactly on 0 and 1
+            yield return TweenSystem.Instance.Wait(TweenSystem.Instance.Value(0f, 1f, crossfadeDuration, setCrossfade));
 
-            // Ensure final alpha values
-            Color finalPrimaryColor = primaryMat.color;
-            Color finalSecondaryColor = secondaryMat.color;
-            finalPrimaryColor.a = 0f;
-            finalSecondaryColor.a = 1f;
-            primaryMat.color = finalPrimaryColor;
-            secondaryMat.color = finalSecondaryColor;
+            fadeOutMaterial = null;
+            fadeInMaterial = null;
         }
 
         // Switch players
@@ -370,6 +353,22 @@ public class StitchVideoManager : MonoBehaviour
             Debug.Log($"StitchVideoManager: Crossfaded to step{step}.mp4");
     }
 
+    private void SetCrossfade(float t)
+    {
+        if (fadeOutMaterial == null || fadeInMaterial == null)
+            return;
+
+        // Fade out primary, fade in secondary
+        Color primaryColor = fadeOutMaterial.color;
+        Color secondaryColor = fadeInMaterial.color;
+
+        primaryColor.a = 1f - t;
+        secondaryColor.a = t;
+
+        fadeOutMaterial.color = primaryColor;
+        fadeInMaterial.color = secondaryColor;
+    }
+
     /// <summary>
     /// Transition with frame hold to avoid white flash
     /// </summary>
@@ -398,7 +397,7 @@ public class StitchVideoManager : MonoBehaviour
         }
 
         // Wait a brief moment to ensure frame is held
-        yield return new WaitForSeconds(frameHoldDuration);
+        yield return TweenSystem.Instance.WaitSeconds(frameHoldDuration);
 
         // Prepare new video
         primaryVideoPlayer.clip = newClip;
@@ -414,7 +413,7 @@ public class StitchVideoManager : MonoBehaviour
         primaryVideoPlayer.Play();
 
         // Wait for first frame of new video to be available
-        yield return new WaitForSeconds(0.1f);
+        yield return TweenSystem.Instance.WaitSeconds(0.1f);
 
         // Restore normal texture assignment (video player will take over)
         if (videoRenderer != null && videoMaterial != null)
@@ -0,0 +1,301 @@
+using UnityEngine;
+
+/// <summary>
+/// Collision shape a thread is kept out of, in world space for one frame.
+/// Spheres and capsules remember the previous frame's pose so fast tools are swept across substeps.
+/// </summary>
+public struct ThreadContactShape
+{
+    public ThreadCollider.Shape shape;
+    public Vector3 a, b;           // Sphere: a = centre. Capsule: segment a-b. Box: a = centre
+    public Vector3 previousA, previousB;
+    public Vector3 axisX, axisY, axisZ; // Box orientation
+    public Vector3 halfExtents;    // Box
+    public float radius;           // Sphere and capsule
+    public float friction;
+}
+
+/// <summary>
+/// One suture thread solved with small-step XPBD: every substep predicts positions from the
+/// implicit velocity, then projects length (stretch), bending and collision constraints.
+/// Positions live in the array the ThreadRenderer hands to its LineRenderer, so nothing is copied.
+/// Mass is one per particle; compliances are relative to that.
+/// </summary>
+public sealed class ThreadBody
+{
+    public readonly Vector3[] Positions;
+    private readonly Vector3[] previous;
+    private readonly float[] inverseMass;
+
+    public float SegmentLength;
+    public float StretchCompliance = 1e-8f;  // Near-inextensible
+    public float BendCompliance = 2e-4f;     // Higher is floppier
+    public float Radius = 0.001f;
+    public Vector3 Gravity = new Vector3(0f, -9.81f, 0f);
+    public float Damping = 0.95f;            // Velocity kept per 1/60 s
+    public bool Active = true;
+
+    private Vector3 startFrom, startTo, endFrom, endTo;
+    private bool pinStart = true;
+    private bool pinEnd = true;
+
+    public int Count => Positions.Length;
+
+    public ThreadBody(Vector3[] positions)
+    {
+        Positions = positions;
+        previous = new Vector3[positions.Length];
+        inverseMass = new float[positions.Length];
+        SetPinned(true, true);
+    }
+
+    /// <summary>
+    /// Pinned ends follow SetAnchors; a free end hangs (for example the tail after the needle)
+    /// </summary>
+    public void SetPinned(bool start, bool end)
+    {
+        pinStart = start;
+        pinEnd = end;
+        for (int i = 0; i < inverseMass.Length; i++)
+            inverseMass[i] = 1f;
+        if (pinStart)
+            inverseMass[0] = 0f;
+        if (pinEnd)
+            inverseMass[inverseMass.Length - 1] = 0f;
+    }
+
+    /// <summary>
+    /// Lay the thread straight from start to end at rest, with the given total length
+    /// </summary>
+    public void Reset(Vector3 start, Vector3 end, float length)
+    {
+        int last = Positions.Length - 1;
+        SegmentLength = length / last;
+        for (int i = 0; i <= last; i++)
+        {
+            Positions[i] = Vector3.Lerp(start, end, (float)i / last);
+            previous[i] = Positions[i];
+        }
+        startFrom = startTo = start;
+        endFrom = endTo = end;
+    }
+
+    /// <summary>
+    /// Move the pinned ends; the motion is spread across the next frame's substeps
+    /// </summary>
+    public void SetAnchors(Vector3 start, Vector3 end)
+    {
+        startTo = start;
+        endTo = end;
+    }
+
+    /// <summary>
+    /// Called once the frame's substeps are done so the next frame sweeps from here
+    /// </summary>
+    public void EndFrame()
+    {
+        startFrom = startTo;
+        endFrom = endTo;
+    }
+
+    /// <summary>
+    /// Advance by h seconds; t is how far through the frame this substep ends (0-1)
+    /// </summary>
+    public void Substep(float h, float t, int iterations, ThreadContactShape[] shapes, int shapeCount)
+    {
+        int n = Positions.Length;
+        int last = n - 1;
+        float keep = Mathf.Pow(Damping, h * 60f);
+        Vector3 gravityStep = Gravity * (h * h);
+
+        // Predict
+        for (int i = 0; i < n; i++)
+        {
+            Vector3 p = Positions[i];
+            if (inverseMass[i] > 0f)
+                Positions[i] = p + (p - previous[i]) * keep + gravityStep;
+            previous[i] = p;
+        }
+        if (pinStart)
+            Positions[0] = Vector3.Lerp(startFrom, startTo, t);
+        if (pinEnd)
+            Positions[last] = Vector3.Lerp(endFrom, endTo, t);
+
+        // Compliance is scaled by 1/h^2 so stiffness doesn't depend on the step size
+        float stretchAlpha = StretchCompliance / (h * h);
+        float bendAlpha = BendCompliance / (h * h);
+        float bendLength = SegmentLength * 2f;
+
+        for (int iteration = 0; iteration < iterations; iteration++)
+        {
+            // Alternate sweep direction so corrections don't only propagate from one end
+            if ((iteration & 1) == 0)
+            {
+                for (int i = 0; i < last; i++)
+                    SolveDistance(i, i + 1, SegmentLength, stretchAlpha, false);
+                for (int i = 0; i < last - 1; i++)
+                    SolveDistance(i, i + 2, bendLength, bendAlpha, true);
+            }
+            else
+            {
+                for (int i = last - 1; i >= 0; i--)
+                    SolveDistance(i, i + 1, SegmentLength, stretchAlpha, false);
+                for (int i = last - 2; i >= 0; i--)
+                    SolveDistance(i, i + 2, bendLength, bendAlpha, true);
+            }
+            SolveTethers();
+        }
+
+        for (int s = 0; s < shapeCount; s++)
+            Collide(ref shapes[s], t);
+    }
+
+    private void SolveDistance(int i, int j, float restLength, float alpha, bool compressionOnly)
+    {
+        float wi = inverseMass[i];
+        float wj = inverseMass[j];
+        float w = wi + wj;
+        if (w <= 0f)
+            return;
+
+        Vector3 delta = Positions[j] - Positions[i];
+        float length = delta.magnitude;
+        if (length < 1e-9f)
+            return;
+
+        // Bending is the distance across two segments: it resists folding, never straightening
+        float c = length - restLength;
+        if (compressionOnly && c >= 0f)
+            return;
+
+        Vector3 correction = delta * (c / ((w + alpha) * length));
+        Positions[i] += correction * wi;
+        Positions[j] -= correction * wj;
+    }
+
+    /// <summary>
+    /// Long-range attachments: no particle may be further from a pinned end than the thread
+    /// length between them. Sweeps alone need many iterations to stop a long chain stretching
+    /// under gravity; this caps the stretch in one pass.
+    /// </summary>
+    private void SolveTethers()
+    {
+        int last = Positions.Length - 1;
+        if (pinStart)
+        {
+            Vector3 anchor = Positions[0];
+            for (int i = 1; i <= last; i++)
+                Tether(i, anchor, SegmentLength * i);
+        }
+        if (pinEnd)
+        {
+            Vector3 anchor = Positions[last];
+            for (int i = 0; i < last; i++)
+                Tether(i, anchor, SegmentLength * (last - i));
+        }
+    }
+
+    private void Tether(int i, Vector3 anchor, float maxDistance)
+    {
+        if (inverseMass[i] == 0f)
+            return;
+
+        Vector3 offset = Positions[i] - anchor;
+        float sqr = offset.sqrMagnitude;
+        if (sqr <= maxDistance * maxDistance)
+            return;
+
+        Positions[i] = anchor + offset * (maxDistance / Mathf.Sqrt(sqr));
+    }
+
+    private void Collide(ref ThreadContactShape shape, float t)
+    {
+        int n = Positions.Length;
+        switch (shape.shape)
+        {
+            case ThreadCollider.Shape.Sphere:
+            {
+                Vector3 centre = Vector3.Lerp(shape.previousA, shape.a, t);
+                float reach = shape.radius + Radius;
+                for (int i = 0; i < n; i++)
+                {
+                    if (inverseMass[i] == 0f)
+                        continue;
+                    Vector3 offset = Positions[i] - centre;
+                    float sqr = offset.sqrMagnitude;
+                    if (sqr >= reach * reach || sqr < 1e-12f)
+                        continue;
+                    float distance = Mathf.Sqrt(sqr);
+                    PushOut(i, offset / distance, reach - distance, shape.friction);
+                }
+                break;
+            }
+            case ThreadCollider.Shape.Capsule:
+            {
+                Vector3 a = Vector3.Lerp(shape.previousA, shape.a, t);
+                Vector3 b = Vector3.Lerp(shape.previousB, shape.b, t);
+                Vector3 axis = b - a;
+                float axisSqr = Mathf.Max(axis.sqrMagnitude, 1e-12f);
+                float reach = shape.radius + Radius;
+                for (int i = 0; i < n; i++)
+                {
+                    if (inverseMass[i] == 0f)
+                        continue;
+                    float along = Mathf.Clamp01(Vector3.Dot(Positions[i] - a, axis) / axisSqr);
+                    Vector3 offset = Positions[i] - (a + axis * along);
+                    float sqr = offset.sqrMagnitude;
+                    if (sqr >= reach * reach || sqr < 1e-12f)
+                        continue;
+                    float distance = Mathf.Sqrt(sqr);
+                    PushOut(i, offset / distance, reach - distance, shape.friction);
+                }
+                break;
+            }
+            case ThreadCollider.Shape.Box:
+            {
+                Vector3 extents = shape.halfExtents + new Vector3(Radius, Radius, Radius);
+                for (int i = 0; i < n; i++)
+                {
+                    if (inverseMass[i] == 0f)
+                        continue;
+                    Vector3 offset = Positions[i] - shape.a;
+                    float x = Vector3.Dot(offset, shape.axisX);
+                    float y = Vector3.Dot(offset, shape.axisY);
+                    float z = Vector3.Dot(offset, shape.axisZ);
+                    float px = extents.x - Mathf.Abs(x);
+                    float py = extents.y - Mathf.Abs(y);
+                    float pz = extents.z - Mathf.Abs(z);
+                    if (px <= 0f || py <= 0f || pz <= 0f)
+                        continue;
+
+                    // Leave through the nearest face
+                    if (px < py && px < pz)
+                        PushOut(i, x >= 0f ? shape.axisX : -shape.axisX, px, shape.friction);
+                    else if (py < pz)
+                        PushOut(i, y >= 0f ? shape.axisY : -shape.axisY, py, shape.friction);
+                    else
+                        PushOut(i, z >= 0f ? shape.axisZ : -shape.axisZ, pz, shape.friction);
+                }
+                break;
+            }
+        }
+    }
+
+    private void PushOut(int i, Vector3 normal, float depth, float friction)
+    {
+        Vector3 p = Positions[i] + normal * depth;
+
+        // Friction removes part of this substep's sliding along the surface
+        Vector3 moved = p - previous[i];
+        Vector3 tangential = moved - normal * Vector3.Dot(moved, normal);
+        Positions[i] = p - tangential * friction;
+    }
+
+    public float Length()
+    {
+        float length = 0f;
+        for (int i = 0; i < Positions.Length - 1; i++)
+            length += Vector3.Distance(Positions[i], Positions[i + 1]);
+        return length;
+    }
+}
@@ -0,0 +1,101 @@
+using UnityEngine;
+
+/// <summary>
+/// Something suture threads can't pass through, such as a skin segment or the needle.
+/// Shapes are analytic so the thread solver never has to query the physics scene.
+/// </summary>
+public class ThreadCollider : MonoBehaviour
+{
+    public enum Shape
+    {
+        Sphere,
+        Capsule, // Along the local Z axis, e.g. a needle
+        Box      // e.g. a skin segment
+    }
+
+    [Header("Shape")]
+    public Shape shape = Shape.Box;
+    public Vector3 center = Vector3.zero;
+    public float radius = 0.001f;          // Sphere and capsule
+    public float length = 0.03f;           // Capsule, end to end excluding caps
+    public Vector3 size = new Vector3(0.05f, 0.005f, 0.05f); // Box
+
+    [Header("Contact")]
+    [Range(0f, 1f)]
+    public float friction = 0.3f;
+
+    private void OnEnable()
+    {
+        ThreadPhysicsSystem.Instance.AddCollider(this);
+    }
+
+    private void OnDisable()
+    {
+        if (ThreadPhysicsSystem.HasInstance)
+            ThreadPhysicsSystem.Instance.RemoveCollider(this);
+    }
+
+    /// <summary>
+    /// Write the current world-space pose into shape, keeping the old pose as the sweep start
+    /// </summary>
+    public void Capture(ref ThreadContactShape contact, bool first)
+    {
+        Transform t = transform;
+        Vector3 scale = t.lossyScale;
+        float radialScale = Mathf.Max(Mathf.Abs(scale.x), Mathf.Abs(scale.y));
+
+        contact.previousA = contact.a;
+        contact.previousB = contact.b;
+        contact.shape = shape;
+        contact.friction = friction;
+
+        switch (shape)
+        {
+            case Shape.Sphere:
+                contact.a = t.TransformPoint(center);
+                contact.radius = radius * Mathf.Max(radialScale, Mathf.Abs(scale.z));
+                break;
+            case Shape.Capsule:
+                Vector3 half = new Vector3(0f, 0f, length * 0.5f);
+                contact.a = t.TransformPoint(center - half);
+                contact.b = t.TransformPoint(center + half);
+                contact.radius = radius * radialScale;
+                break;
+            case Shape.Box:
+                contact.a = t.TransformPoint(center);
+                contact.axisX = t.right;
+                contact.axisY = t.up;
+                contact.axisZ = t.forward;
+                contact.halfExtents = Vector3.Scale(size, scale) * 0.5f;
+                contact.halfExtents = new Vector3(Mathf.Abs(contact.halfExtents.x), Mathf.Abs(contact.halfExtents.y), Mathf.Abs(contact.halfExtents.z));
+                break;
+        }
+
+        if (first)
+        {
+            contact.previousA = contact.a;
+            contact.previousB = contact.b;
+        }
+    }
+
+    private void OnDrawGizmosSelected()
+    {
+        Gizmos.color = Color.cyan;
+        Gizmos.matrix = transform.localToWorldMatrix;
+        switch (shape)
+        {
+            case Shape.Sphere:
+                Gizmos.DrawWireSphere(center, radius);
+                break;
+            case Shape.Capsule:
+                Vector3 half = new Vector3(0f, 0f, length * 0.5f);
+                Gizmos.DrawWireSphere(center - half, radius);
+                Gizmos.DrawWireSphere(center + half, radius);
+                Gizmos.DrawLine(center - half, center + half);
+                break;
+            case Shape.Box:
+                Gizmos.DrawWireCube(center, size);
+                break;
+        }
+    }
+}
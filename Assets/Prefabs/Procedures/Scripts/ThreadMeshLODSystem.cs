@@ -0,0 +1,149 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+/// <summary>
+/// Chooses the ring and side counts of every ThreadTubeMesh each frame.
+/// Each thread starts at the level its distance from the HMD calls for; if the total still
+/// exceeds maxTotalVertices, the farthest threads are coarsened first until it fits, so a
+/// closed wound with dozens of stitches costs a bounded amount while the one in hand stays round.
+/// Runs before the meshes rebuild in their LateUpdate.
+/// </summary>
+[DefaultExecutionOrder(-10)]
+public class ThreadMeshLODSystem : MonoBehaviour
+{
+    [Header("Levels")]
+    public float[] levelDistances = { 0.6f, 1.2f, 2.5f }; // Metres from the HMD where each coarser level starts
+    public int[] radialSides = { 8, 6, 4, 3 };
+    public int[] pointStrides = { 1, 1, 2, 4 };
+
+    [Header("Budget")]
+    public int maxTotalVertices = 8000;
+
+    private static ThreadMeshLODSystem instance;
+
+    private readonly List<ThreadTubeMesh> meshes = new List<ThreadTubeMesh>();
+    private readonly List<int> order = new List<int>();
+    private float[] distances = new float[16];
+    private int[] levels = new int[16];
+    private System.Comparison<int> fartherFirst;
+
+    public static ThreadMeshLODSystem Instance
+    {
+        get
+        {
+            if (instance == null)
+            {
+                instance = FindObjectOfType<ThreadMeshLODSystem>();
+                if (instance == null)
+                {
+                    instance = new GameObject("ThreadMeshLODSystem").AddComponent<ThreadMeshLODSystem>();
+                }
+            }
+            return instance;
+        }
+    }
+
+    public static bool HasInstance => instance != null;
+
+    /// <summary>
+    /// Vertices across all threads after last frame's LOD choice
+    /// </summary>
+    public int TotalVertices { get; private set; }
+
+    private void Awake()
+    {
+        if (instance == null)
+        {
+            instance = this;
+        }
+        else if (instance != this)
+        {
+            Debug.LogWarning("Multiple ThreadMeshLODSystem instances found. Using the first one.");
+        }
+
+        fartherFirst = (a, b) => distances[b].CompareTo(distances[a]);
+    }
+
+    private void OnDestroy()
+    {
+        if (instance == this)
+        {
+            instance = null;
+        }
+    }
+
+    public void AddMesh(ThreadTubeMesh mesh)
+    {
+        if (mesh != null && !meshes.Contains(mesh))
+            meshes.Add(mesh);
+    }
+
+    public void RemoveMesh(ThreadTubeMesh mesh)
+    {
+        meshes.Remove(mesh);
+    }
+
+    private void LateUpdate()
+    {
+        int count = meshes.Count;
+        if (count == 0)
+        {
+            TotalVertices = 0;
+            return;
+        }
+
+        int levelCount = Mathf.Min(radialSides.Length, pointStrides.Length);
+        if (levelCount == 0)
+        {
+            Debug.LogError("ThreadMeshLODSystem needs at least one level of radialSides and pointStrides");
+            return;
+        }
+
+        if (distances.Length < count)
+        {
+            distances = new float[Mathf.NextPowerOfTwo(count)];
+            levels = new int[distances.Length];
+        }
+
+        Camera eye = Camera.main;
+        Vector3 eyePosition = eye != null ? eye.transform.position : Vector3.zero;
+        int total = 0;
+        order.Clear();
+
+        for (int i = 0; i < count; i++)
+        {
+            ThreadTubeMesh mesh = meshes[i];
+            float distance = eye != null ? Vector3.Distance(eyePosition, mesh.Midpoint) : 0f;
+            int level = 0;
+            while (level < levelDistances.Length && level < levelCount - 1 && distance >= levelDistances[level])
+                level++;
+
+            distances[i] = distance;
+            levels[i] = level;
+            total += mesh.VertexCountAt(radialSides[level], pointStrides[level]);
+            order.Add(i);
+        }
+
+        // Over budget: coarsen the farthest threads first
+        if (total > maxTotalVertices)
+        {
+            order.Sort(fartherFirst);
+            for (int o = 0; o < order.Count && total > maxTotalVertices; o++)
+            {
+                int i = order[o];
+                ThreadTubeMesh mesh = meshes[i];
+                while (levels[i] < levelCount - 1 && total > maxTotalVertices)
+                {
+                    total -= mesh.VertexCountAt(radialSides[levels[i]], pointStrides[levels[i]]);
+                    levels[i]++;
+                    total += mesh.VertexCountAt(radialSides[levels[i]], pointStrides[levels[i]]);
+                }
+            }
+        }
+
+        for (int i = 0; i < count; i++)
+            meshes[i].SetDetail(radialSides[levels[i]], pointStrides[levels[i]]);
+
+        TotalVertices = total;
+    }
+}
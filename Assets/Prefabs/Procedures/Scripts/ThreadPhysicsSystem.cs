@@ -0,0 +1,154 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+/// <summary>
+/// Steps every suture thread in the scene at a fixed substep, independent of frame rate.
+/// Each frame the elapsed time is split into substeps of 1/substepRate seconds, up to
+/// maxSubstepsPerFrame; time beyond that budget is dropped so a slow frame makes the thread
+/// briefly lag rather than making the next frame slower still.
+/// Runs before ThreadRenderer.Update so renderers upload this frame's positions.
+/// </summary>
+[DefaultExecutionOrder(-30)]
+public class ThreadPhysicsSystem : MonoBehaviour
+{
+    [Header("Solver")]
+    public float substepRate = 240f;
+    public int maxSubstepsPerFrame = 8;
+    public int iterations = 2; // Constraint sweeps per substep
+
+    private static ThreadPhysicsSystem instance;
+
+    private readonly List<ThreadBody> bodies = new List<ThreadBody>();
+    private readonly List<ThreadCollider> colliders = new List<ThreadCollider>();
+    private ThreadContactShape[] shapes = new ThreadContactShape[8];
+    private readonly List<bool> freshColliders = new List<bool>();
+    private float accumulator = 0f;
+    private double lastStepMilliseconds = 0;
+    private readonly System.Diagnostics.Stopwatch timer = new System.Diagnostics.Stopwatch();
+
+    public static ThreadPhysicsSystem Instance
+    {
+        get
+        {
+            if (instance == null)
+            {
+                instance = FindObjectOfType<ThreadPhysicsSystem>();
+                if (instance == null)
+                {
+                    instance = new GameObject("ThreadPhysicsSystem").AddComponent<ThreadPhysicsSystem>();
+                }
+            }
+            return instance;
+        }
+    }
+
+    public static bool HasInstance => instance != null;
+
+    /// <summary>
+    /// Time spent solving last frame, for profiling
+    /// </summary>
+    public double LastStepMilliseconds => lastStepMilliseconds;
+
+    private void Awake()
+    {
+        if (instance == null)
+        {
+            instance = this;
+        }
+        else if (instance != this)
+        {
+            Debug.LogWarning("Multiple ThreadPhysicsSystem instances found. Using the first one.");
+        }
+    }
+
+    private void OnDestroy()
+    {
+        if (instance == this)
+        {
+            instance = null;
+        }
+    }
+
+    public void AddBody(ThreadBody body)
+    {
+        if (body != null && !bodies.Contains(body))
+            bodies.Add(body);
+    }
+
+    public void RemoveBody(ThreadBody body)
+    {
+        bodies.Remove(body);
+    }
+
+    public void AddCollider(ThreadCollider collider)
+    {
+        if (collider == null || colliders.Contains(collider))
+            return;
+        colliders.Add(collider);
+        freshColliders.Add(true);
+    }
+
+    public void RemoveCollider(ThreadCollider collider)
+    {
+        int index = colliders.IndexOf(collider);
+        if (index < 0)
+            return;
+
+        // Keep shapes parallel to colliders
+        int last = colliders.Count - 1;
+        colliders[index] = colliders[last];
+        freshColliders[index] = freshColliders[last];
+        shapes[index] = shapes[last];
+        colliders.RemoveAt(last);
+        freshColliders.RemoveAt(last);
+    }
+
+    private void Update()
+    {
+        if (bodies.Count == 0)
+        {
+            accumulator = 0f;
+            return;
+        }
+
+        float h = 1f / Mathf.Max(1f, substepRate);
+        accumulator += Time.deltaTime;
+        int substeps = Mathf.FloorToInt(accumulator / h);
+        accumulator -= substeps * h;
+        if (substeps > maxSubstepsPerFrame)
+        {
+            substeps = maxSubstepsPerFrame;
+            accumulator = 0f;
+        }
+        if (substeps == 0)
+            return;
+
+        timer.Restart();
+        CaptureColliders();
+
+        for (int b = 0; b < bodies.Count; b++)
+        {
+            ThreadBody body = bodies[b];
+            if (!body.Active)
+                continue;
+
+            for (int s = 1; s <= substeps; s++)
+                body.Substep(h, (float)s / substeps, iterations, shapes, colliders.Count);
+            body.EndFrame();
+        }
+
+        lastStepMilliseconds = timer.Elapsed.TotalMilliseconds;
+    }
+
+    private void CaptureColliders()
+    {
+        if (shapes.Length < colliders.Count)
+            System.Array.Resize(ref shapes, Mathf.NextPowerOfTwo(colliders.Count));
+
+        for (int i = 0; i < colliders.Count; i++)
+        {
+            colliders[i].Capture(ref shapes[i], freshColliders[i]);
+            freshColliders[i] = false;
+        }
+    }
+}
@@ -11,12 +11,15 @@ public class ThreadRenderer : MonoBehaviour
     public float threadWidth = 0.002f;
     public Color threadColor = Color.white;
     public int threadResolution = 20; // Number of points along the thread
+    public bool useTubeMesh = true; // Round mesh tube with distance LOD instead of a flat LineRenderer ribbon
     
     [Header("Physics Simulation")]
-    public bool enablePhysics = true;
+    public bool enablePhysics = true; // Stepped by the ThreadPhysicsSystem; collides with ThreadColliders
     public float gravity = -9.81f;
-    public float damping = 0.95f;
-    public float tension = 50f; // Thread tension
+    public float damping = 0.95f; // Velocity kept per 1/60 s
+    public float slack = 1.05f; // Thread length relative to the distance between its ends
+    public float stretchCompliance = 1e-8f; // 0 is inextensible
+    public float bendCompliance = 2e-4f; // Higher is floppier
     
     [Header("Animation")]
     public float creationSpeed = 2f;
@@ -25,8 +28,9 @@ public class ThreadRenderer : MonoBehaviour
     
     // Private variables
     private LineRenderer lineRenderer;
-    private Vector3[] threadPoints;
-    private Vector3[] threadVelocities;
+    private ThreadTubeMesh tube;
+    private Vector3[] threadPoints; // Solved in place by the ThreadBody
+    private ThreadBody body;
     private Vector3 startPoint;
     private Vector3 endPoint;
     private bool isAnimating = false;
@@ -64,17 +68,48 @@ public class ThreadRenderer : MonoBehaviour
         lineRenderer.shadowCastingMode = UnityEngine.Rendering.ShadowCastingMode.Off;
         lineRenderer.receiveShadows = false;
         lineRenderer.textureMode = LineTextureMode.Tile;
+        
+        if (useTubeMesh)
+        {
+            // The tube lives on a child so it gets its own MeshRenderer; the ribbon stays as a fallback
+            GameObject tubeObject = new GameObject("ThreadTube");
+            tubeObject.transform.SetParent(transform, false);
+            tube = tubeObject.AddComponent<ThreadTubeMesh>();
+            tube.radius = threadWidth * 0.5f;
+            tube.SetMaterial(threadMaterial);
+            tube.SetColor(threadColor);
+            lineRenderer.enabled = false;
+        }
     }
     
     private void InitializeThreadPoints()
     {
+        threadResolution = Mathf.Max(threadResolution, 3);
+        lineRenderer.positionCount = threadResolution;
         threadPoints = new Vector3[threadResolution];
-        threadVelocities = new Vector3[threadResolution];
-        
-        // Initialize velocities to zero
-        for (int i = 0; i < threadResolution; i++)
+        body = new ThreadBody(threadPoints) { Active = false };
+        ApplyPhysicsSettings();
+    }
+    
+    private void ApplyPhysicsSettings()
+    {
+        body.Gravity = new Vector3(0f, gravity, 0f);
+        body.Damping = damping;
+        body.StretchCompliance = stretchCompliance;
+        body.BendCompliance = bendCompliance;
+        body.Radius = threadWidth * 0.5f;
+    }
+    
+    private void OnEnable()
+    {
+        ThreadPhysicsSystem.Instance.AddBody(body);
+    }
+    
+    private void OnDisable()
+    {
+        if (ThreadPhysicsSystem.HasInstance)
         {
-            threadVelocities[i] = Vector3.zero;
+            ThreadPhysicsSystem.Instance.RemoveBody(body);
         }
     }
     
@@ -98,12 +133,9 @@ public class ThreadRenderer : MonoBehaviour
     
     private void SetupImmediateThread()
     {
-        // Set up thread points in a straight line initially
-        for (int i = 0; i < threadResolution; i++)
-        {
-            float t = (float)i / (threadResolution - 1);
-            threadPoints[i] = Vector3.Lerp(startPoint, endPoint, t);
-        }
+        // Set up thread points in a straight line initially; the solver lets the slack sag
+        body.Reset(startPoint, endPoint, Vector3.Distance(startPoint, endPoint) * Mathf.Max(1f, slack));
+        body.Active = enablePhysics;
         
         UpdateLineRenderer();
     }
@@ -112,6 +144,7 @@ public class ThreadRenderer : MonoBehaviour
     {
         isAnimating = true;
         animationProgress = 0f;
+        body.Active = false;
         
         while (animationProgress < 1f)
         {
@@ -147,46 +180,35 @@ public class ThreadRenderer : MonoBehaviour
     
     private void Update()
     {
-        if (enablePhysics && !isAnimating)
+        // The ThreadPhysicsSystem has already stepped this frame
+        if (body.Active && !isAnimating)
         {
-            SimulatePhysics();
             UpdateLineRenderer();
         }
     }
     
-    private void SimulatePhysics()
+    /// <summary>
+    /// Push Inspector changes to the solver (gravity, damping, compliances, width)
+    /// </summary>
+    public void RefreshPhysicsSettings()
     {
-        float deltaTime = Time.deltaTime;
-        
-        // Apply physics to internal points (not endpoints)
-        for (int i = 1; i < threadResolution - 1; i++)
+        if (body != null)
         {
-            Vector3 currentPoint = threadPoints[i];
-            
-            // Calculate tension forces from neighboring points
-            Vector3 leftTension = (threadPoints[i - 1] - currentPoint) * tension;
-            Vector3 rightTension = (threadPoints[i + 1] - currentPoint) * tension;
-            Vector3 totalTension = leftTension + rightTension;
-            
-            // Apply gravity
-            Vector3 gravityForce = Vector3.up * gravity;
-            
-            // Update velocity
-            threadVelocities[i] += (totalTension + gravityForce) * deltaTime;
-            threadVelocities[i] *= damping; // Apply damping
-            
-            // Update position
-            threadPoints[i] += threadVelocities[i] * deltaTime;
+            ApplyPhysicsSettings();
+            body.Active = enablePhysics && !isAnimating;
         }
-        
-        // Keep endpoints fixed
-        threadPoints[0] = startPoint;
-        threadPoints[threadResolution - 1] = endPoint;
     }
     
     private void UpdateLineRenderer()
     {
-        lineRenderer.SetPositions(threadPoints);
+        if (tube != null)
+        {
+            tube.SetPolyline(threadPoints, threadResolution);
+        }
+        else
+        {
+            lineRenderer.SetPositions(threadPoints);
+        }
     }
     
     /// <summary>
@@ -197,11 +219,10 @@ public class ThreadRenderer : MonoBehaviour
         startPoint = newStart;
         endPoint = newEnd;
         
-        // Update endpoint positions
-        if (threadPoints != null && threadPoints.Length > 0)
+        // The solver moves the pinned ends there over its next substeps
+        if (body != null)
         {
-            threadPoints[0] = startPoint;
-            threadPoints[threadResolution - 1] = endPoint;
+            body.SetAnchors(startPoint, endPoint);
         }
     }
     
@@ -221,6 +242,10 @@ public class ThreadRenderer : MonoBehaviour
             );
             lineRenderer.colorGradient = gradient;
         }
+        if (tube != null)
+        {
+            tube.SetColor(color);
+        }
     }
     
     /// <summary>
@@ -229,11 +254,19 @@ public class ThreadRenderer : MonoBehaviour
     public void SetThreadWidth(float width)
     {
         threadWidth = width;
+        if (body != null)
+        {
+            body.Radius = width * 0.5f;
+        }
         if (lineRenderer != null)
         {
             lineRenderer.startWidth = width;
             lineRenderer.endWidth = width;
         }
+        if (tube != null)
+        {
+            tube.radius = width * 0.5f;
+        }
     }
     
     /// <summary>
@@ -241,7 +274,11 @@ public class ThreadRenderer : MonoBehaviour
     /// </summary>
     public void SetVisible(bool visible)
     {
-        if (lineRenderer != null)
+        if (tube != null)
+        {
+            tube.gameObject.SetActive(visible);
+        }
+        else if (lineRenderer != null)
         {
             lineRenderer.enabled = visible;
         }
@@ -252,13 +289,6 @@ public class ThreadRenderer : MonoBehaviour
     /// </summary>
     public float GetThreadLength()
     {
-        float length = 0f;
-        
-        for (int i = 0; i < threadResolution - 1; i++)
-        {
-            length += Vector3.Distance(threadPoints[i], threadPoints[i + 1]);
-        }
-        
-        return length;
+        return body.Length();
     }
 }
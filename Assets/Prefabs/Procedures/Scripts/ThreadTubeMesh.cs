@@ -0,0 +1,335 @@
+using UnityEngine;
+using UnityEngine.Rendering;
+
+/// <summary>
+/// Draws a suture thread as a low-poly tube instead of a camera-facing ribbon, so it keeps its
+/// roundness in stereo. Rings are oriented with rotation-minimising (parallel-transport) frames
+/// so the tube doesn't twist as the thread bends. The mesh and its arrays are allocated once;
+/// each frame only vertex positions, normals and UVs are rewritten in place, and triangles only
+/// when the ThreadMeshLODSystem changes this thread's ring and side counts.
+/// </summary>
+[RequireComponent(typeof(MeshFilter), typeof(MeshRenderer))]
+public class ThreadTubeMesh : MonoBehaviour
+{
+    [Header("Tube")]
+    public float radius = 0.001f;
+    public float uvTiling = 1f; // Texture repeats per circumference-length of thread
+
+    private Mesh mesh;
+    private MeshRenderer meshRenderer;
+    private MaterialPropertyBlock propertyBlock;
+
+    // Source polyline, world space
+    private Vector3[] points = new Vector3[0];
+    private int pointCount = 0;
+    private bool dirty = false;
+
+    // Persistent mesh buffers; grown to the largest level used, never shrunk
+    private Vector3[] vertices = new Vector3[0];
+    private Vector3[] normals = new Vector3[0];
+    private Vector2[] uvs = new Vector2[0];
+    private int[] indices = new int[0];
+    private Vector3[] ringCentres = new Vector3[0];
+    private Vector3[] ringTangents = new Vector3[0];
+    private float[] ringDistances = new float[0];
+    private float[] ringCos = new float[0];
+    private float[] ringSin = new float[0];
+
+    // Current topology
+    private int builtSides = -1;
+    private int builtRings = -1;
+    private int sides = 8;
+    private int stride = 1;
+
+    public int PointCount => pointCount;
+
+    /// <summary>
+    /// Middle of the thread in world space, for distance LOD
+    /// </summary>
+    public Vector3 Midpoint => pointCount > 0 ? points[pointCount / 2] : transform.position;
+
+    /// <summary>
+    /// Vertices the tube would use with the given detail
+    /// </summary>
+    public int VertexCountAt(int radialSides, int pointStride)
+    {
+        return RingCount(Mathf.Max(1, pointStride)) * (Mathf.Max(3, radialSides) + 1);
+    }
+
+    private void Awake()
+    {
+        mesh = new Mesh { name = "ThreadTube" };
+        mesh.MarkDynamic();
+        GetComponent<MeshFilter>().sharedMesh = mesh;
+        meshRenderer = GetComponent<MeshRenderer>();
+        meshRenderer.shadowCastingMode = ShadowCastingMode.Off;
+        meshRenderer.receiveShadows = false;
+    }
+
+    private void OnEnable()
+    {
+        ThreadMeshLODSystem.Instance.AddMesh(this);
+    }
+
+    private void OnDisable()
+    {
+        if (ThreadMeshLODSystem.HasInstance)
+            ThreadMeshLODSystem.Instance.RemoveMesh(this);
+    }
+
+    private void OnDestroy()
+    {
+        if (mesh != null)
+            Destroy(mesh);
+    }
+
+    public void SetMaterial(Material material)
+    {
+        if (meshRenderer != null)
+            meshRenderer.sharedMaterial = material;
+    }
+
+    /// <summary>
+    /// Tint without instancing the shared material
+    /// </summary>
+    public void SetColor(Color color)
+    {
+        if (meshRenderer == null)
+            return;
+        if (propertyBlock == null)
+            propertyBlock = new MaterialPropertyBlock();
+        meshRenderer.GetPropertyBlock(propertyBlock);
+        propertyBlock.SetColor("_BaseColor", color);
+        propertyBlock.SetColor("_Color", color);
+        meshRenderer.SetPropertyBlock(propertyBlock);
+    }
+
+    /// <summary>
+    /// Follow these world-space points; the tube is rebuilt in LateUpdate
+    /// </summary>
+    public void SetPolyline(Vector3[] source, int count)
+    {
+        if (points.Length < count)
+            points = new Vector3[count];
+        System.Array.Copy(source, points, count);
+        pointCount = count;
+        dirty = true;
+    }
+
+    /// <summary>
+    /// Called by the ThreadMeshLODSystem before LateUpdate
+    /// </summary>
+    public void SetDetail(int radialSides, int pointStride)
+    {
+        radialSides = Mathf.Max(3, radialSides);
+        pointStride = Mathf.Max(1, pointStride);
+        if (radialSides != sides || pointStride != stride)
+        {
+            sides = radialSides;
+            stride = pointStride;
+            dirty = true;
+        }
+    }
+
+    /// <summary>
+    /// Rings used at a given stride: every stride-th point, always ending on the last one
+    /// </summary>
+    public int RingCount(int pointStride)
+    {
+        if (pointCount < 2)
+            return 0;
+        return (pointCount - 2) / pointStride + 2;
+    }
+
+    private void LateUpdate()
+    {
+        if (!dirty)
+            return;
+        dirty = false;
+        Rebuild();
+    }
+
+    private void Rebuild()
+    {
+        int rings = RingCount(stride);
+        if (rings < 2)
+        {
+            mesh.Clear();
+            builtRings = builtSides = -1;
+            return;
+        }
+
+        EnsureCapacity(rings);
+        GatherRings(rings);
+
+        int ringVertices = sides + 1; // Seam vertex is duplicated for the UV wrap
+        int vertexCount = rings * ringVertices;
+        WriteVertices(rings, ringVertices);
+
+        bool topologyChanged = rings != builtRings || sides != builtSides;
+        if (topologyChanged)
+        {
+            // Drop the old indices first so they never reference vertices that no longer exist
+            mesh.SetIndices(indices, 0, 0, MeshTopology.Triangles, 0, false);
+        }
+
+        const MeshUpdateFlags flags = MeshUpdateFlags.DontValidateIndices | MeshUpdateFlags.DontRecalculateBounds;
+        mesh.SetVertices(vertices, 0, vertexCount, flags);
+        mesh.SetNormals(normals, 0, vertexCount, flags);
+        mesh.SetUVs(0, uvs, 0, vertexCount, flags);
+
+        if (topologyChanged)
+        {
+            int indexCount = WriteIndices(rings, ringVertices);
+            mesh.SetIndices(indices, 0, indexCount, MeshTopology.Triangles, 0, false);
+            builtRings = rings;
+            builtSides = sides;
+        }
+
+        mesh.bounds = ComputeBounds(rings);
+    }
+
+    private void EnsureCapacity(int rings)
+    {
+        int vertexCount = rings * (sides + 1);
+        if (vertices.Length < vertexCount)
+        {
+            vertices = new Vector3[vertexCount];
+            normals = new Vector3[vertexCount];
+            uvs = new Vector2[vertexCount];
+        }
+
+        int indexCount = (rings - 1) * sides * 6;
+        if (indices.Length < indexCount)
+            indices = new int[indexCount];
+
+        if (ringCentres.Length < rings)
+        {
+            ringCentres = new Vector3[rings];
+            ringTangents = new Vector3[rings];
+            ringDistances = new float[rings];
+        }
+    }
+
+    private void GatherRings(int rings)
+    {
+        Matrix4x4 worldToLocal = transform.worldToLocalMatrix;
+        for (int r = 0; r < rings; r++)
+        {
+            int index = r == rings - 1 ? pointCount - 1 : r * stride;
+            ringCentres[r] = worldToLocal.MultiplyPoint3x4(points[index]);
+        }
+
+        float distance = 0f;
+        for (int r = 0; r < rings; r++)
+        {
+            Vector3 previous = ringCentres[Mathf.Max(r - 1, 0)];
+            Vector3 next = ringCentres[Mathf.Min(r + 1, rings - 1)];
+            Vector3 tangent = next - previous;
+            float length = tangent.magnitude;
+            ringTangents[r] = length > 1e-7f ? tangent / length : (r > 0 ? ringTangents[r - 1] : Vector3.forward);
+
+            if (r > 0)
+                distance += Vector3.Distance(ringCentres[r - 1], ringCentres[r]);
+            ringDistances[r] = distance;
+        }
+    }
+
+    private void WriteVertices(int rings, int ringVertices)
+    {
+        if (ringCos.Length != sides + 1)
+        {
+            ringCos = new float[sides + 1];
+            ringSin = new float[sides + 1];
+            for (int s = 0; s <= sides; s++)
+            {
+                float angle = s * 2f * Mathf.PI / sides;
+                ringCos[s] = Mathf.Cos(angle);
+                ringSin[s] = Mathf.Sin(angle);
+            }
+        }
+
+        float circumference = Mathf.Max(2f * Mathf.PI * radius, 1e-6f);
+
+        // Any normal perpendicular to the first tangent starts the frame
+        Vector3 tangent = ringTangents[0];
+        Vector3 normal = Vector3.Cross(tangent, Mathf.Abs(tangent.y) < 0.9f ? Vector3.up : Vector3.right).normalized;
+
+        for (int r = 0; r < rings; r++)
+        {
+            if (r > 0)
+                normal = TransportNormal(ringCentres[r - 1], ringCentres[r], ringTangents[r - 1], ringTangents[r], normal);
+
+            Vector3 binormal = Vector3.Cross(ringTangents[r], normal);
+            Vector3 centre = ringCentres[r];
+            float v = ringDistances[r] / circumference * uvTiling;
+            int baseVertex = r * ringVertices;
+
+            for (int s = 0; s <= sides; s++)
+            {
+                Vector3 direction = normal * ringCos[s] + binormal * ringSin[s];
+                vertices[baseVertex + s] = centre + direction * radius;
+                normals[baseVertex + s] = direction;
+                uvs[baseVertex + s] = new Vector2((float)s / sides, v);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Double-reflection rotation-minimising frame (Wang et al. 2008): carries the normal from
+    /// one ring to the next with no twist about the tangent
+    /// </summary>
+    private static Vector3 TransportNormal(Vector3 fromPoint, Vector3 toPoint, Vector3 fromTangent, Vector3 toTangent, Vector3 normal)
+    {
+        Vector3 v1 = toPoint - fromPoint;
+        float c1 = Vector3.Dot(v1, v1);
+        if (c1 < 1e-12f)
+            return normal;
+
+        Vector3 reflectedNormal = normal - (2f / c1) * Vector3.Dot(v1, normal) * v1;
+        Vector3 reflectedTangent = fromTangent - (2f / c1) * Vector3.Dot(v1, fromTangent) * v1;
+        Vector3 v2 = toTangent - reflectedTangent;
+        float c2 = Vector3.Dot(v2, v2);
+        if (c2 < 1e-12f)
+            return reflectedNormal;
+
+        Vector3 result = reflectedNormal - (2f / c2) * Vector3.Dot(v2, reflectedNormal) * v2;
+        return result.normalized;
+    }
+
+    private int WriteIndices(int rings, int ringVertices)
+    {
+        int i = 0;
+        for (int r = 0; r < rings - 1; r++)
+        {
+            int ring = r * ringVertices;
+            int nextRing = ring + ringVertices;
+            for (int s = 0; s < sides; s++)
+            {
+                // Unity front faces wind clockwise seen from outside
+                indices[i++] = ring + s;
+                indices[i++] = ring + s + 1;
+                indices[i++] = nextRing + s;
+
+                indices[i++] = ring + s + 1;
+                indices[i++] = nextRing + s + 1;
+                indices[i++] = nextRing + s;
+            }
+        }
+        return i;
+    }
+
+    private Bounds ComputeBounds(int rings)
+    {
+        Vector3 min = ringCentres[0];
+        Vector3 max = ringCentres[0];
+        for (int r = 1; r < rings; r++)
+        {
+            min = Vector3.Min(min, ringCentres[r]);
+            max = Vector3.Max(max, ringCentres[r]);
+        }
+        Bounds bounds = new Bounds();
+        bounds.SetMinMax(min - Vector3.one * radius, max + Vector3.one * radius);
+        return bounds;
+    }
+}
@@ -9,6 +9,7 @@ public class VRStitchTool : MonoBehaviour
     [Header("Tool Settings")]
     public ToolType toolType = ToolType.Needle;
     public bool isActivelyHeld = false;
+    public Vector3 tipOffset = Vector3.zero; // Needle tip in local space; stitch proximity is measured from here
     
     [Header("Haptic Feedback")]
     public bool enableHaptics = true;
@@ -22,6 +23,7 @@ public class VRStitchTool : MonoBehaviour
     
     // Private variables
     private Renderer toolRenderer;
+    private int toolOverride = -1; // RendererOverrideSystem handle for toolRenderer
     private bool isNearStitchSite = false;
     
     // Events
@@ -39,15 +41,43 @@ public class VRStitchTool : MonoBehaviour
         toolRenderer = GetComponent<Renderer>();
     }
     
+    private void OnEnable()
+    {
+        StitchProximitySystem.Instance.AddTool(this);
+    }
+    
+    private void OnDisable()
+    {
+        if (StitchProximitySystem.HasInstance)
+        {
+            StitchProximitySystem.Instance.RemoveTool(this);
+        }
+    }
+    
+    /// <summary>
+    /// World position of the needle tip
+    /// </summary>
+    public Vector3 TipPosition => transform.TransformPoint(tipOffset);
+    
     private void Start()
     {
-        // Set initial color
+        // Set initial color through a property override, so the shared material is never copied
         if (toolRenderer != null)
         {
-            toolRenderer.material.color = normalColor;
+            toolOverride = RendererOverrideSystem.Instance.Register(toolRenderer);
+            RendererOverrideSystem.Instance.SetTint(toolOverride, normalColor);
         }
     }
     
+    private void OnDestroy()
+    {
+        if (RendererOverrideSystem.HasInstance)
+        {
+            RendererOverrideSystem.Instance.Unregister(toolOverride);
+        }
+        toolOverride = -1;
+    }
+    
     /// <summary>
     /// Called when the tool is grabbed by the player
     /// </summary>
@@ -76,22 +106,22 @@ public class VRStitchTool : MonoBehaviour
         }
         
         // Reset color
-        if (toolRenderer != null)
+        if (toolOverride >= 0)
         {
-            toolRenderer.material.color = normalColor;
+            RendererOverrideSystem.Instance.SetHighlight(toolOverride, readyToStitchColor, 0f);
         }
     }
     
     /// <summary>
-    /// Called when near a stitch site
+    /// Called by the StitchProximitySystem when the tip nears its first stitch point or leaves its last
     /// </summary>
     public void SetNearStitchSite(bool near)
     {
         isNearStitchSite = near;
         
-        if (toolRenderer != null)
+        if (toolOverride >= 0)
         {
-            toolRenderer.material.color = near ? readyToStitchColor : normalColor;
+            RendererOverrideSystem.Instance.SetHighlight(toolOverride, readyToStitchColor, near ? 1f : 0f);
         }
         
         // Provide haptic feedback if enabled
@@ -0,0 +1,349 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+/// <summary>
+/// Laplacian (harmonic displacement) deformation of a skin mesh around suture anchors.
+/// Vertices within anchorRadius of an anchor point are moved by that anchor's offset; vertices
+/// farther than influenceRadius from every anchor stay at rest; the displacement of everything in
+/// between is solved so each vertex moves by the average of its neighbours, which spreads the pull
+/// smoothly into the surrounding tissue while keeping the surface detail. Solved with warm-started
+/// successive over-relaxation, so a few sweeps per frame track a suture that tightens gradually.
+/// Vertices split along UV or normal seams are welded for the solve so the skin can't tear, and
+/// share one bend of their normals so seams stay invisible. Only vertices the anchors influence are
+/// written; everything else keeps its imported position and normal.
+/// Holds no Unity objects and may run on any thread, one at a time.
+/// </summary>
+public sealed class WoundDeformationSolver
+{
+    public struct Anchor
+    {
+        public Vector3 point;  // Mesh local space
+        public Vector3 offset; // Where the tissue at point is pulled, relative to point
+    }
+
+    private const int Fixed = -1;
+    private const int Free = -2;
+
+    private readonly Vector3[] rest;      // Per mesh vertex
+    private readonly Vector3[] restNormals;
+    private readonly int[] triangles;
+    private readonly int[] weldedOf;      // Mesh vertex -> welded vertex
+    private readonly Vector3[] weldedRest;
+    private readonly int[] neighbourStart; // Welded adjacency, compressed rows
+    private readonly int[] neighbours;
+    private readonly Vector3[] displacement;
+    private readonly int[] role;           // Fixed, Free, or the index of the anchor holding it
+    private readonly int[] copyStart;      // Welded vertex -> its mesh vertices, compressed rows
+    private readonly int[] copies;
+    private readonly int[] triangleStart;  // Welded vertex -> triangles touching it, compressed rows
+    private readonly int[] weldedTriangles;
+    private readonly Vector3[] restFaceNormals; // Area-weighted geometric normal at rest, per welded vertex
+    private readonly bool[] written;
+
+    private int[] freeVertices = new int[0];
+    private int freeCount = 0;
+    private int[] anchoredVertices = new int[0];
+    private int anchoredCount = 0;
+    private int[] writtenVertices = new int[0]; // Welded vertices moved away from rest by Write
+    private int writtenCount = 0;
+
+    public int VertexCount => rest.Length;
+    public int WeldedCount => weldedRest.Length;
+    public int FreeCount => freeCount;
+    public int AnchoredCount => anchoredCount;
+
+    /// <summary>
+    /// restNormals are the imported normals, restored when the tissue returns to rest; a mesh
+    /// without normals can pass null and gets geometric normals where it deforms.
+    /// </summary>
+    public WoundDeformationSolver(Vector3[] restVertices, Vector3[] restNormals, int[] meshTriangles, float weldDistance)
+    {
+        rest = restVertices;
+        this.restNormals = restNormals != null && restNormals.Length == restVertices.Length ? restNormals : new Vector3[restVertices.Length];
+        triangles = meshTriangles;
+        weldedOf = new int[rest.Length];
+
+        // Weld coincident vertices
+        float cell = Mathf.Max(weldDistance, 1e-7f);
+        Dictionary<long, int> welded = new Dictionary<long, int>(rest.Length);
+        List<Vector3> weldedPositions = new List<Vector3>(rest.Length);
+        for (int i = 0; i < rest.Length; i++)
+        {
+            Vector3 p = rest[i];
+            long key = PackCell(Mathf.RoundToInt(p.x / cell), Mathf.RoundToInt(p.y / cell), Mathf.RoundToInt(p.z / cell));
+            if (!welded.TryGetValue(key, out int index))
+            {
+                index = weldedPositions.Count;
+                welded[key] = index;
+                weldedPositions.Add(p);
+            }
+            weldedOf[i] = index;
+        }
+        weldedRest = weldedPositions.ToArray();
+        int count = weldedRest.Length;
+        displacement = new Vector3[count];
+        role = new int[count];
+
+        // Unique edges between welded vertices
+        HashSet<long> edges = new HashSet<long>();
+        int[] degree = new int[count];
+        for (int t = 0; t + 2 < triangles.Length; t += 3)
+        {
+            AddEdge(edges, degree, weldedOf[triangles[t]], weldedOf[triangles[t + 1]]);
+            AddEdge(edges, degree, weldedOf[triangles[t + 1]], weldedOf[triangles[t + 2]]);
+            AddEdge(edges, degree, weldedOf[triangles[t + 2]], weldedOf[triangles[t]]);
+        }
+
+        neighbourStart = new int[count + 1];
+        for (int i = 0; i < count; i++)
+            neighbourStart[i + 1] = neighbourStart[i] + degree[i];
+        neighbours = new int[neighbourStart[count]];
+
+        int[] fill = new int[count];
+        foreach (long edge in edges)
+        {
+            int a = (int)(edge >> 32);
+            int b = (int)(edge & 0xFFFFFFFF);
+            neighbours[neighbourStart[a] + fill[a]++] = b;
+            neighbours[neighbourStart[b] + fill[b]++] = a;
+        }
+
+        for (int i = 0; i < count; i++)
+            role[i] = Fixed;
+
+        // Mesh vertices and triangles of each welded vertex
+        copyStart = new int[count + 1];
+        copies = new int[rest.Length];
+        triangleStart = new int[count + 1];
+        for (int i = 0; i < rest.Length; i++)
+            copyStart[weldedOf[i] + 1]++;
+        for (int t = 0; t + 2 < triangles.Length; t += 3)
+        {
+            for (int c = 0; c < 3; c++)
+                triangleStart[weldedOf[triangles[t + c]] + 1]++;
+        }
+        for (int i = 0; i < count; i++)
+        {
+            copyStart[i + 1] += copyStart[i];
+            triangleStart[i + 1] += triangleStart[i];
+        }
+        weldedTriangles = new int[triangleStart[count]];
+
+        System.Array.Clear(fill, 0, count);
+        for (int i = 0; i < rest.Length; i++)
+        {
+            int w = weldedOf[i];
+            copies[copyStart[w] + fill[w]++] = i;
+        }
+        System.Array.Clear(fill, 0, count);
+        for (int t = 0; t + 2 < triangles.Length; t += 3)
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                int w = weldedOf[triangles[t + c]];
+                weldedTriangles[triangleStart[w] + fill[w]++] = t;
+            }
+        }
+
+        // Displacement is still zero, so this is the rest shape
+        restFaceNormals = new Vector3[count];
+        for (int i = 0; i < count; i++)
+            restFaceNormals[i] = FaceNormal(i);
+        written = new bool[count];
+    }
+
+    /// <summary>
+    /// Choose which vertices are held, solved and fixed for this set of anchors.
+    /// Needed whenever anchors are added or removed; offsets alone go through UpdateOffsets.
+    /// </summary>
+    public void SetAnchors(Anchor[] anchors, int anchorCount, float anchorRadius, float influenceRadius)
+    {
+        float anchorSqr = anchorRadius * anchorRadius;
+        float influenceSqr = influenceRadius * influenceRadius;
+        freeCount = 0;
+        anchoredCount = 0;
+
+        for (int i = 0; i < weldedRest.Length; i++)
+        {
+            Vector3 p = weldedRest[i];
+            int nearest = -1;
+            float nearestSqr = float.MaxValue;
+            for (int a = 0; a < anchorCount; a++)
+            {
+                float sqr = (p - anchors[a].point).sqrMagnitude;
+                if (sqr < nearestSqr)
+                {
+                    nearestSqr = sqr;
+                    nearest = a;
+                }
+            }
+
+            if (nearest >= 0 && nearestSqr <= anchorSqr)
+            {
+                role[i] = nearest;
+                Append(ref anchoredVertices, ref anchoredCount, i);
+            }
+            else if (nearest >= 0 && nearestSqr <= influenceSqr)
+            {
+                // Keeps its current displacement as the starting guess
+                role[i] = Free;
+                Append(ref freeVertices, ref freeCount, i);
+            }
+            else
+            {
+                role[i] = Fixed;
+                displacement[i] = Vector3.zero;
+            }
+        }
+
+        UpdateOffsets(anchors);
+    }
+
+    /// <summary>
+    /// Move the held vertices to their anchors' current offsets (same anchors as SetAnchors)
+    /// </summary>
+    public void UpdateOffsets(Anchor[] anchors)
+    {
+        for (int k = 0; k < anchoredCount; k++)
+        {
+            int i = anchoredVertices[k];
+            displacement[i] = anchors[role[i]].offset;
+        }
+    }
+
+    /// <summary>
+    /// Over-relaxed Gauss-Seidel sweeps over the free vertices. Returns the largest change in the
+    /// last sweep, so the caller can stop once the tissue has settled.
+    /// </summary>
+    public float Solve(int iterations, float relaxation)
+    {
+        float largest = 0f;
+        for (int iteration = 0; iteration < iterations; iteration++)
+        {
+            largest = 0f;
+            for (int k = 0; k < freeCount; k++)
+            {
+                int i = freeVertices[k];
+                int start = neighbourStart[i];
+                int end = neighbourStart[i + 1];
+                if (end == start)
+                    continue;
+
+                Vector3 sum = Vector3.zero;
+                for (int n = start; n < end; n++)
+                    sum += displacement[neighbours[n]];
+
+                Vector3 current = displacement[i];
+                Vector3 next = current + relaxation * (sum / (end - start) - current);
+                displacement[i] = next;
+                largest = Mathf.Max(largest, (next - current).sqrMagnitude);
+            }
+        }
+        return Mathf.Sqrt(largest);
+    }
+
+    /// <summary>
+    /// Write deformed positions and normals for the vertices the anchors influence. Each normal is
+    /// the imported one turned by however much the welded surface around it has bent, so hard edges
+    /// stay hard and seam duplicates stay matched. Vertices no longer influenced get their imported
+    /// position and normal back.
+    /// </summary>
+    public void Write(Vector3[] vertices, Vector3[] normals)
+    {
+        int kept = 0;
+        for (int k = 0; k < writtenCount; k++)
+        {
+            int w = writtenVertices[k];
+            if (role[w] != Fixed)
+            {
+                writtenVertices[kept++] = w;
+                continue;
+            }
+
+            written[w] = false;
+            for (int c = copyStart[w]; c < copyStart[w + 1]; c++)
+            {
+                int i = copies[c];
+                vertices[i] = rest[i];
+                normals[i] = restNormals[i];
+            }
+        }
+        writtenCount = kept;
+
+        for (int k = 0; k < anchoredCount; k++)
+            WriteWelded(anchoredVertices[k], vertices, normals);
+        for (int k = 0; k < freeCount; k++)
+            WriteWelded(freeVertices[k], vertices, normals);
+    }
+
+    private void WriteWelded(int w, Vector3[] vertices, Vector3[] normals)
+    {
+        if (!written[w])
+        {
+            written[w] = true;
+            Append(ref writtenVertices, ref writtenCount, w);
+        }
+
+        Vector3 normal = FaceNormal(w);
+        Quaternion bend = restFaceNormals[w] != Vector3.zero && normal != Vector3.zero
+            ? Quaternion.FromToRotation(restFaceNormals[w], normal)
+            : Quaternion.identity;
+
+        for (int c = copyStart[w]; c < copyStart[w + 1]; c++)
+        {
+            int i = copies[c];
+            vertices[i] = rest[i] + displacement[w];
+            normals[i] = restNormals[i] != Vector3.zero ? bend * restNormals[i] : normal;
+        }
+    }
+
+    /// <summary>
+    /// Normalized area-weighted normal of the welded surface around a welded vertex, as displaced
+    /// </summary>
+    private Vector3 FaceNormal(int w)
+    {
+        Vector3 sum = Vector3.zero;
+        for (int n = triangleStart[w]; n < triangleStart[w + 1]; n++)
+        {
+            int t = weldedTriangles[n];
+            int a = weldedOf[triangles[t]];
+            int b = weldedOf[triangles[t + 1]];
+            int c = weldedOf[triangles[t + 2]];
+            Vector3 pa = weldedRest[a] + displacement[a];
+            sum += Vector3.Cross(weldedRest[b] + displacement[b] - pa, weldedRest[c] + displacement[c] - pa);
+        }
+
+        float length = sum.magnitude;
+        return length > 1e-12f ? sum / length : Vector3.zero;
+    }
+
+    private static void AddEdge(HashSet<long> edges, int[] degree, int a, int b)
+    {
+        if (a == b)
+            return;
+        if (a > b)
+        {
+            int swap = a;
+            a = b;
+            b = swap;
+        }
+        if (edges.Add(((long)a << 32) | (uint)b))
+        {
+            degree[a]++;
+            degree[b]++;
+        }
+    }
+
+    private static void Append(ref int[] list, ref int count, int value)
+    {
+        if (count == list.Length)
+            System.Array.Resize(ref list, Mathf.Max(64, list.Length * 2));
+        list[count++] = value;
+    }
+
+    // 21 bits per axis, as in the StitchProximitySystem hash
+    private static long PackCell(int x, int y, int z)
+    {
+        return ((long)(x & 0x1FFFFF) << 42) | ((long)(y & 0x1FFFFF) << 21) | (long)(z & 0x1FFFFF);
+    }
+}
@@ -0,0 +1,264 @@
+using UnityEngine;
+using UnityEngine.Rendering;
+using System.Collections.Generic;
+using System.Threading;
+using System;
+
+/// <summary>
+/// Pulls the wound edges of a skin mesh together around each stitch instead of sliding whole
+/// skin objects. Every stitch anchors the tissue at its two stitch points and drags it toward
+/// their midpoint as its tension rises; a WoundDeformationSolver spreads that into the
+/// surrounding skin. The solve runs on a worker thread while the rest of the frame runs and
+/// writes into persistent vertex and normal buffers, which the next Update uploads to the mesh
+/// (one frame behind). Once the tissue settles nothing is solved or uploaded.
+/// </summary>
+[RequireComponent(typeof(MeshFilter))]
+public class WoundEdgeDeformer : MonoBehaviour
+{
+    [Header("Anchors")]
+    public float anchorRadius = 0.004f;    // Tissue within this of a stitch point moves with it
+    public float influenceRadius = 0.03f;  // Tissue beyond this from every stitch point stays put
+
+    [Header("Solver")]
+    public int iterationsPerFrame = 24;
+    [Range(1f, 1.95f)]
+    public float relaxation = 1.7f;
+    public float settleThreshold = 1e-6f;  // Metres of change per sweep below which solving stops
+    public float weldDistance = 1e-5f;     // Seam vertices closer than this move together
+
+    private struct Stitch
+    {
+        public Vector3 first;  // Local space
+        public Vector3 second;
+        public float closure;
+        public float tension;
+        public bool inUse;
+    }
+
+    private Mesh mesh;
+    private Vector3[] restVertices;
+    private Vector3[] restNormals;
+    private int[] triangles;
+    private Bounds restBounds;
+    private Vector3[] vertices;
+    private Vector3[] normals;
+    private WoundDeformationSolver solver;
+
+    private Stitch[] stitches = new Stitch[16];
+    private int stitchCount = 0;
+    private readonly Stack<int> freeStitches = new Stack<int>();
+    private bool anchorsChanged = false;
+    private bool offsetsChanged = false;
+
+    // Worker hand-off; the worker owns solver, anchors, vertices and normals while a solve runs
+    private Thread worker;
+    private readonly AutoResetEvent solveRequested = new AutoResetEvent(false);
+    private readonly ManualResetEvent solveDone = new ManualResetEvent(true);
+    private volatile bool stopping = false;
+    private WoundDeformationSolver.Anchor[] anchors = new WoundDeformationSolver.Anchor[32];
+    private int anchorCount = 0;
+    private bool reclassify = false;
+    private bool resultReady = false;
+    private bool settled = true;
+    private float largestOffset = 0f;
+    private double lastSolveMilliseconds = 0;
+
+    /// <summary>
+    /// Worker time spent on the last solve, for profiling
+    /// </summary>
+    public double LastSolveMilliseconds => lastSolveMilliseconds;
+
+    private void Awake()
+    {
+        mesh = GetComponent<MeshFilter>().mesh; // Own instance; the shared asset is left untouched
+        if (mesh == null || !mesh.isReadable)
+        {
+            Debug.LogError($"WoundEdgeDeformer on {gameObject.name} needs a readable mesh (enable Read/Write in the import settings)");
+            enabled = false;
+            return;
+        }
+
+        mesh.MarkDynamic();
+        restVertices = mesh.vertices;
+        triangles = mesh.triangles;
+        restBounds = mesh.bounds;
+        vertices = (Vector3[])restVertices.Clone();
+        restNormals = mesh.normals;
+        if (restNormals == null || restNormals.Length != vertices.Length)
+            restNormals = new Vector3[vertices.Length];
+        normals = (Vector3[])restNormals.Clone();
+    }
+
+    private void OnEnable()
+    {
+        if (mesh == null)
+            return;
+
+        stopping = false;
+        worker = new Thread(WorkerLoop) { IsBackground = true, Name = "WoundEdgeDeformer" };
+        worker.Start();
+    }
+
+    private void OnDisable()
+    {
+        stopping = true;
+        solveRequested.Set();
+        worker?.Join();
+        worker = null;
+        solveDone.Set();
+    }
+
+    private void OnDestroy()
+    {
+        if (mesh != null)
+            Destroy(mesh);
+    }
+
+    /// <summary>
+    /// Anchor a stitch between two world-space points. Closure is how far toward each other the
+    /// edges are drawn at full tension (1 = they meet). Returns the handle for SetTension and RemoveStitch.
+    /// </summary>
+    public int AddStitch(Vector3 firstPoint, Vector3 secondPoint, float closure)
+    {
+        int handle;
+        if (freeStitches.Count > 0)
+        {
+            handle = freeStitches.Pop();
+        }
+        else
+        {
+            if (stitchCount == stitches.Length)
+                Array.Resize(ref stitches, stitches.Length * 2);
+            handle = stitchCount++;
+        }
+
+        stitches[handle] = new Stitch
+        {
+            first = transform.InverseTransformPoint(firstPoint),
+            second = transform.InverseTransformPoint(secondPoint),
+            closure = Mathf.Clamp01(closure),
+            tension = 0f,
+            inUse = true
+        };
+        anchorsChanged = true;
+        return handle;
+    }
+
+    /// <summary>
+    /// 0 leaves the tissue at rest, 1 pulls the edges the stitch's full closure
+    /// </summary>
+    public void SetTension(int handle, float tension)
+    {
+        if (handle < 0 || handle >= stitchCount || !stitches[handle].inUse)
+            return;
+
+        tension = Mathf.Clamp01(tension);
+        if (stitches[handle].tension != tension)
+        {
+            stitches[handle].tension = tension;
+            offsetsChanged = true;
+        }
+    }
+
+    /// <summary>
+    /// Release a stitch; its tissue relaxes back to rest
+    /// </summary>
+    public void RemoveStitch(int handle)
+    {
+        if (handle < 0 || handle >= stitchCount || !stitches[handle].inUse)
+            return;
+
+        stitches[handle] = default;
+        freeStitches.Push(handle);
+        anchorsChanged = true;
+    }
+
+    private void Update()
+    {
+        // The worker normally finished long ago; if not, let it run on and pick up changes next frame
+        if (!solveDone.WaitOne(0))
+            return;
+
+        if (resultReady)
+        {
+            const MeshUpdateFlags flags = MeshUpdateFlags.DontValidateIndices | MeshUpdateFlags.DontRecalculateBounds;
+            mesh.SetVertices(vertices, 0, vertices.Length, flags);
+            mesh.SetNormals(normals, 0, normals.Length, flags);
+            Bounds bounds = restBounds;
+            bounds.Expand(largestOffset * 2f);
+            mesh.bounds = bounds;
+            resultReady = false;
+        }
+
+        if (!anchorsChanged && !offsetsChanged && settled)
+            return;
+
+        GatherAnchors();
+        reclassify = anchorsChanged;
+        anchorsChanged = false;
+        offsetsChanged = false;
+
+        if (worker != null)
+        {
+            solveDone.Reset();
+            solveRequested.Set();
+        }
+    }
+
+    private void GatherAnchors()
+    {
+        anchorCount = 0;
+        largestOffset = 0f;
+        for (int i = 0; i < stitchCount; i++)
+        {
+            Stitch stitch = stitches[i];
+            if (!stitch.inUse)
+                continue;
+
+            if (anchorCount + 2 > anchors.Length)
+                Array.Resize(ref anchors, anchors.Length * 2);
+
+            // Each edge travels half the gap at full closure
+            Vector3 pull = (stitch.second - stitch.first) * (0.5f * stitch.closure * stitch.tension);
+            anchors[anchorCount++] = new WoundDeformationSolver.Anchor { point = stitch.first, offset = pull };
+            anchors[anchorCount++] = new WoundDeformationSolver.Anchor { point = stitch.second, offset = -pull };
+            largestOffset = Mathf.Max(largestOffset, pull.magnitude);
+        }
+    }
+
+    private void WorkerLoop()
+    {
+        System.Diagnostics.Stopwatch timer = new System.Diagnostics.Stopwatch();
+        while (true)
+        {
+            solveRequested.WaitOne();
+            if (stopping)
+                return;
+
+            timer.Restart();
+            try
+            {
+                // Welding and adjacency are built here the first time so Awake stays cheap
+                if (solver == null)
+                    solver = new WoundDeformationSolver(restVertices, restNormals, triangles, weldDistance);
+
+                if (reclassify)
+                    solver.SetAnchors(anchors, anchorCount, anchorRadius, influenceRadius);
+                else
+                    solver.UpdateOffsets(anchors);
+
+                float change = solver.Solve(Mathf.Max(1, iterationsPerFrame), relaxation);
+                solver.Write(vertices, normals);
+                settled = change < settleThreshold;
+                resultReady = true;
+            }
+            catch (Exception e)
+            {
+                Debug.LogError($"WoundEdgeDeformer solve failed: {e.Message}");
+                settled = true;
+            }
+            lastSolveMilliseconds = timer.Elapsed.TotalMilliseconds;
+            solveDone.Set();
+        }
+    }
+}
@@ -0,0 +1,125 @@
+using UnityEngine;
+using UnityEngine.Events;
+using System.Collections.Generic;
+
+/// <summary>
+/// A region tool tips can enter, such as a skin layer, an incision line or a vial opening.
+/// Tested analytically by the ToolTipContactSystem; no collider or rigidbody is needed.
+/// </summary>
+public class ContactVolume : MonoBehaviour
+{
+    public enum Shape { Sphere, Box }
+
+    [Header("Shape")]
+    public Shape shape = Shape.Box;
+    public Vector3 center = Vector3.zero;
+    public float radius = 0.05f;            // Sphere
+    public Vector3 size = Vector3.one * 0.1f; // Box
+    public bool isStatic = false;           // Static volumes are captured once instead of every frame
+
+    [Header("Filter")]
+    public string acceptedTag = ""; // Only tips on objects with this tag; empty accepts any
+
+    [Header("Events")]
+    public UnityEvent<ToolTipContact> OnTipEntered = new UnityEvent<ToolTipContact>();
+    public UnityEvent<ToolTipContact> OnTipExited = new UnityEvent<ToolTipContact>();
+
+    // World-space pose, refreshed by the ToolTipContactSystem
+    internal Vector3 worldCenter;
+    internal Vector3 axisX, axisY, axisZ;
+    internal Vector3 halfExtents;
+    internal float worldRadius;
+    internal Vector3 boundsMin, boundsMax;
+    internal bool captured = false;
+    internal readonly List<ToolTip> tipsInside = new List<ToolTip>();
+
+    private void OnEnable()
+    {
+        captured = false;
+        ToolTipContactSystem.Instance.AddVolume(this);
+    }
+
+    private void OnDisable()
+    {
+        if (ToolTipContactSystem.HasInstance)
+            ToolTipContactSystem.Instance.RemoveVolume(this);
+    }
+
+    /// <summary>
+    /// Take shape, centre and size from an existing collider (box and sphere; others use their bounds)
+    /// </summary>
+    public void FitTo(Collider source)
+    {
+        if (source is BoxCollider box)
+        {
+            shape = Shape.Box;
+            center = transform.InverseTransformPoint(box.transform.TransformPoint(box.center));
+            size = box.size;
+            if (box.transform != transform)
+                size = Vector3.Scale(size, Divide(box.transform.lossyScale, transform.lossyScale));
+        }
+        else if (source is SphereCollider sphere)
+        {
+            shape = Shape.Sphere;
+            center = transform.InverseTransformPoint(sphere.transform.TransformPoint(sphere.center));
+            Vector3 scale = sphere.transform.lossyScale;
+            radius = sphere.radius * Mathf.Max(Mathf.Abs(scale.x), Mathf.Abs(scale.y), Mathf.Abs(scale.z));
+            Vector3 ownScale = transform.lossyScale;
+            radius /= Mathf.Max(Mathf.Max(Mathf.Abs(ownScale.x), Mathf.Abs(ownScale.y), Mathf.Abs(ownScale.z)), 1e-6f);
+        }
+        else if (source != null)
+        {
+            shape = Shape.Box;
+            Bounds bounds = source.bounds;
+            center = transform.InverseTransformPoint(bounds.center);
+            size = Divide(bounds.size, transform.lossyScale);
+        }
+        captured = false;
+    }
+
+    private static Vector3 Divide(Vector3 a, Vector3 b)
+    {
+        return new Vector3(a.x / Mathf.Max(Mathf.Abs(b.x), 1e-6f), a.y / Mathf.Max(Mathf.Abs(b.y), 1e-6f), a.z / Mathf.Max(Mathf.Abs(b.z), 1e-6f));
+    }
+
+    internal void Capture()
+    {
+        Transform t = transform;
+        Vector3 scale = t.lossyScale;
+        worldCenter = t.TransformPoint(center);
+
+        if (shape == Shape.Sphere)
+        {
+            worldRadius = radius * Mathf.Max(Mathf.Abs(scale.x), Mathf.Abs(scale.y), Mathf.Abs(scale.z));
+            Vector3 extent = new Vector3(worldRadius, worldRadius, worldRadius);
+            boundsMin = worldCenter - extent;
+            boundsMax = worldCenter + extent;
+        }
+        else
+        {
+            axisX = t.right;
+            axisY = t.up;
+            axisZ = t.forward;
+            halfExtents = new Vector3(Mathf.Abs(size.x * scale.x), Mathf.Abs(size.y * scale.y), Mathf.Abs(size.z * scale.z)) * 0.5f;
+            Vector3 extent = Abs(axisX) * halfExtents.x + Abs(axisY) * halfExtents.y + Abs(axisZ) * halfExtents.z;
+            boundsMin = worldCenter - extent;
+            boundsMax = worldCenter + extent;
+        }
+        captured = true;
+    }
+
+    private static Vector3 Abs(Vector3 v)
+    {
+        return new Vector3(Mathf.Abs(v.x), Mathf.Abs(v.y), Mathf.Abs(v.z));
+    }
+
+    private void OnDrawGizmosSelected()
+    {
+        Gizmos.color = Color.yellow;
+        Gizmos.matrix = transform.localToWorldMatrix;
+        if (shape == Shape.Sphere)
+            Gizmos.DrawWireSphere(center, radius);
+        else
+            Gizmos.DrawWireCube(center, size);
+    }
+}
@@ -0,0 +1,96 @@
+using UnityEngine;
+using UnityEngine.Events;
+
+/// <summary>
+/// The sharp or absorbent end of a handheld instrument (needle, scalpel, swab).
+/// The ToolTipContactSystem sweeps it from last frame's position to this frame's, so a fast
+/// flick can't skip through a thin target between two tracking samples.
+/// </summary>
+public class ToolTip : MonoBehaviour
+{
+    [Header("Tip")]
+    public Vector3 tipOffset = Vector3.zero; // In local space
+    public float radius = 0.003f;
+    public float maxSweepDistance = 0.5f;    // Longer moves in one frame are teleports (e.g. regrab) and aren't swept
+
+    [Header("Events")]
+    public UnityEvent<ToolTipContact> OnVolumeEntered = new UnityEvent<ToolTipContact>();
+    public UnityEvent<ToolTipContact> OnVolumeExited = new UnityEvent<ToolTipContact>();
+
+    internal Vector3 previousPosition;
+    internal Vector3 currentPosition;
+    internal bool hasPrevious = false;
+
+    /// <summary>
+    /// World position of the tip now
+    /// </summary>
+    public Vector3 Position => transform.TransformPoint(tipOffset);
+
+    private void OnEnable()
+    {
+        hasPrevious = false;
+        ToolTipContactSystem.Instance.AddTip(this);
+    }
+
+    private void OnDisable()
+    {
+        if (ToolTipContactSystem.HasInstance)
+            ToolTipContactSystem.Instance.RemoveTip(this);
+    }
+
+    /// <summary>
+    /// Add a tip to a tool that has none configured, placed at the far end of its colliders.
+    /// Instrument prefabs should carry their own ToolTip; this only keeps old ones working.
+    /// </summary>
+    public static ToolTip AddTo(GameObject tool)
+    {
+        ToolTip tip = tool.AddComponent<ToolTip>();
+        if (tip.FitToColliders())
+            Debug.LogWarning($"{tool.name} has no ToolTip configured; guessed the tip from its colliders at {tip.tipOffset}");
+        else
+            Debug.LogError($"{tool.name} has no ToolTip configured and no colliders to place one from; contact is swept from its pivot");
+        return tip;
+    }
+
+    /// <summary>
+    /// Put the tip at the end of the tool's longest local axis farthest from its pivot (a blade's
+    /// point, a swab's head). Returns false if the tool has no colliders.
+    /// </summary>
+    public bool FitToColliders()
+    {
+        Collider[] colliders = GetComponentsInChildren<Collider>();
+        bool any = false;
+        Vector3 min = Vector3.zero, max = Vector3.zero;
+
+        foreach (Collider collider in colliders)
+        {
+            Bounds bounds = collider.bounds;
+            for (int corner = 0; corner < 8; corner++)
+            {
+                Vector3 world = new Vector3(
+                    (corner & 1) != 0 ? bounds.max.x : bounds.min.x,
+                    (corner & 2) != 0 ? bounds.max.y : bounds.min.y,
+                    (corner & 4) != 0 ? bounds.max.z : bounds.min.z);
+                Vector3 local = transform.InverseTransformPoint(world);
+                min = any ? Vector3.Min(min, local) : local;
+                max = any ? Vector3.Max(max, local) : local;
+                any = true;
+            }
+        }
+        if (!any)
+            return false;
+
+        Vector3 size = max - min;
+        int axis = size.x >= size.y && size.x >= size.z ? 0 : (size.y >= size.z ? 1 : 2);
+        Vector3 offset = (min + max) * 0.5f;
+        offset[axis] = Mathf.Abs(max[axis]) >= Mathf.Abs(min[axis]) ? max[axis] : min[axis];
+        tipOffset = offset;
+        return true;
+    }
+
+    private void OnDrawGizmosSelected()
+    {
+        Gizmos.color = Color.red;
+        Gizmos.DrawWireSphere(Position, radius);
+    }
+}
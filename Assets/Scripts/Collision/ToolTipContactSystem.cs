@@ -0,0 +1,303 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+/// <summary>
+/// A tool tip entering or leaving a ContactVolume.
+/// </summary>
+public struct ToolTipContact
+{
+    public ToolTip tip;
+    public ContactVolume volume;
+    public float fraction;  // Where in the last frame's motion it happened (0 = previous pose, 1 = now)
+    public double time;     // Time.timeAsDouble at that moment
+    public Vector3 point;   // Tip centre at that moment
+    public Vector3 normal;  // Surface normal of the volume where it was crossed, pointing out
+}
+
+/// <summary>
+/// Continuous contact between tool tips and target volumes.
+/// Each frame every tip is swept as a sphere along the segment from its previous position to
+/// its current one and tested against each volume whose bounds the sweep overlaps. Entries report
+/// the exact time of impact and entry point, even when the tip passed straight through within a
+/// single frame (it then enters and exits in the same update).
+/// Runs in LateUpdate so tracked tools have their final pose for the frame.
+/// </summary>
+[DefaultExecutionOrder(-10)]
+public class ToolTipContactSystem : MonoBehaviour
+{
+    private static ToolTipContactSystem instance;
+
+    private readonly List<ToolTip> tips = new List<ToolTip>();
+    private readonly List<ContactVolume> volumes = new List<ContactVolume>();
+    private readonly List<ToolTipContact> entered = new List<ToolTipContact>();
+    private readonly List<ToolTipContact> exited = new List<ToolTipContact>();
+    private double lastUpdateMilliseconds = 0;
+    private readonly System.Diagnostics.Stopwatch timer = new System.Diagnostics.Stopwatch();
+
+    public static ToolTipContactSystem Instance
+    {
+        get
+        {
+            if (instance == null)
+            {
+                instance = FindObjectOfType<ToolTipContactSystem>();
+                if (instance == null)
+                {
+                    instance = new GameObject("ToolTipContactSystem").AddComponent<ToolTipContactSystem>();
+                }
+            }
+            return instance;
+        }
+    }
+
+    public static bool HasInstance => instance != null;
+
+    /// <summary>
+    /// Time spent sweeping last frame, for profiling
+    /// </summary>
+    public double LastUpdateMilliseconds => lastUpdateMilliseconds;
+
+    private void Awake()
+    {
+        if (instance == null)
+        {
+            instance = this;
+        }
+        else if (instance != this)
+        {
+            Debug.LogWarning("Multiple ToolTipContactSystem instances found. Using the first one.");
+        }
+    }
+
+    private void OnDestroy()
+    {
+        if (instance == this)
+        {
+            instance = null;
+        }
+    }
+
+    public void AddTip(ToolTip tip)
+    {
+        if (tip != null && !tips.Contains(tip))
+            tips.Add(tip);
+    }
+
+    public void RemoveTip(ToolTip tip)
+    {
+        tips.Remove(tip);
+        foreach (ContactVolume volume in volumes)
+            volume.tipsInside.Remove(tip);
+    }
+
+    public void AddVolume(ContactVolume volume)
+    {
+        if (volume != null && !volumes.Contains(volume))
+            volumes.Add(volume);
+    }
+
+    public void RemoveVolume(ContactVolume volume)
+    {
+        volumes.Remove(volume);
+        volume.tipsInside.Clear();
+    }
+
+    private void LateUpdate()
+    {
+        timer.Restart();
+
+        double now = Time.timeAsDouble;
+        float frameSeconds = Time.deltaTime;
+
+        foreach (ToolTip tip in tips)
+        {
+            tip.previousPosition = tip.hasPrevious ? tip.currentPosition : tip.Position;
+            tip.currentPosition = tip.Position;
+            tip.hasPrevious = true;
+
+            // A regrab or reset can move the tool across the room in one frame; don't sweep that
+            if ((tip.currentPosition - tip.previousPosition).sqrMagnitude > tip.maxSweepDistance * tip.maxSweepDistance)
+                tip.previousPosition = tip.currentPosition;
+        }
+
+        foreach (ContactVolume volume in volumes)
+        {
+            if (!volume.captured || !volume.isStatic)
+                volume.Capture();
+
+            for (int t = 0; t < tips.Count; t++)
+                TestPair(tips[t], volume, now, frameSeconds);
+        }
+
+        lastUpdateMilliseconds = timer.Elapsed.TotalMilliseconds;
+
+        // Handlers may disable tips or volumes, so they run after the sweep
+        foreach (ToolTipContact contact in entered)
+        {
+            contact.volume.OnTipEntered?.Invoke(contact);
+            contact.tip.OnVolumeEntered?.Invoke(contact);
+        }
+        foreach (ToolTipContact contact in exited)
+        {
+            contact.volume.OnTipExited?.Invoke(contact);
+            contact.tip.OnVolumeExited?.Invoke(contact);
+        }
+        entered.Clear();
+        exited.Clear();
+    }
+
+    private void TestPair(ToolTip tip, ContactVolume volume, double now, float frameSeconds)
+    {
+        Vector3 p0 = tip.previousPosition;
+        Vector3 p1 = tip.currentPosition;
+        float r = tip.radius;
+        bool wasInside = volume.tipsInside.Contains(tip);
+
+        // Broad phase: bounds of the swept tip against the volume's bounds
+        if (!wasInside)
+        {
+            Vector3 min = Vector3.Min(p0, p1) - new Vector3(r, r, r);
+            Vector3 max = Vector3.Max(p0, p1) + new Vector3(r, r, r);
+            if (min.x > volume.boundsMax.x || max.x < volume.boundsMin.x ||
+                min.y > volume.boundsMax.y || max.y < volume.boundsMin.y ||
+                min.z > volume.boundsMax.z || max.z < volume.boundsMin.z)
+                return;
+
+            if (!string.IsNullOrEmpty(volume.acceptedTag) && !tip.CompareTag(volume.acceptedTag))
+                return;
+        }
+
+        bool insideNow = Contains(volume, p1, r);
+
+        if (!wasInside)
+        {
+            if (!Sweep(volume, p0, p1, r, out float fraction, out Vector3 normal))
+                return;
+
+            entered.Add(MakeContact(tip, volume, fraction, normal, p0, p1, now, frameSeconds));
+            if (insideNow)
+            {
+                volume.tipsInside.Add(tip);
+                return;
+            }
+
+            // Passed straight through this frame: the exit is where the reverse sweep enters
+            Sweep(volume, p1, p0, r, out float back, out Vector3 exitNormal);
+            exited.Add(MakeContact(tip, volume, 1f - back, exitNormal, p0, p1, now, frameSeconds));
+        }
+        else if (!insideNow)
+        {
+            volume.tipsInside.Remove(tip);
+            Sweep(volume, p1, p0, r, out float back, out Vector3 exitNormal);
+            exited.Add(MakeContact(tip, volume, 1f - back, exitNormal, p0, p1, now, frameSeconds));
+        }
+    }
+
+    private static ToolTipContact MakeContact(ToolTip tip, ContactVolume volume, float fraction, Vector3 normal, Vector3 p0, Vector3 p1, double now, float frameSeconds)
+    {
+        return new ToolTipContact
+        {
+            tip = tip,
+            volume = volume,
+            fraction = fraction,
+            time = now - (1f - fraction) * frameSeconds,
+            point = Vector3.LerpUnclamped(p0, p1, fraction),
+            normal = normal
+        };
+    }
+
+    private static bool Contains(ContactVolume volume, Vector3 p, float r)
+    {
+        if (volume.shape == ContactVolume.Shape.Sphere)
+        {
+            float reach = volume.worldRadius + r;
+            return (p - volume.worldCenter).sqrMagnitude <= reach * reach;
+        }
+
+        Vector3 offset = p - volume.worldCenter;
+        return Mathf.Abs(Vector3.Dot(offset, volume.axisX)) <= volume.halfExtents.x + r &&
+               Mathf.Abs(Vector3.Dot(offset, volume.axisY)) <= volume.halfExtents.y + r &&
+               Mathf.Abs(Vector3.Dot(offset, volume.axisZ)) <= volume.halfExtents.z + r;
+    }
+
+    /// <summary>
+    /// First time along p0 -> p1 (0-1) at which a sphere of radius r touches the volume.
+    /// Boxes are grown by r on every face, which slightly overstates the rounded corners.
+    /// </summary>
+    private static bool Sweep(ContactVolume volume, Vector3 p0, Vector3 p1, float r, out float fraction, out Vector3 normal)
+    {
+        Vector3 d = p1 - p0;
+        fraction = 0f;
+
+        if (volume.shape == ContactVolume.Shape.Sphere)
+        {
+            Vector3 m = p0 - volume.worldCenter;
+            float reach = volume.worldRadius + r;
+            float c = m.sqrMagnitude - reach * reach;
+            float distance = m.magnitude;
+            normal = distance > 1e-6f ? m / distance : Vector3.up;
+            if (c <= 0f)
+                return true; // Already touching at the start
+
+            float a = d.sqrMagnitude;
+            float b = Vector3.Dot(m, d);
+            if (b >= 0f || a < 1e-12f)
+                return false; // Moving away or not moving
+
+            float discriminant = b * b - a * c;
+            if (discriminant < 0f)
+                return false;
+
+            fraction = (-b - Mathf.Sqrt(discriminant)) / a;
+            if (fraction > 1f)
+                return false;
+
+            Vector3 hit = m + d * fraction;
+            normal = hit / Mathf.Max(hit.magnitude, 1e-6f);
+            return true;
+        }
+
+        // Box: slab test in the box's frame
+        Vector3 offset = p0 - volume.worldCenter;
+        float enter = 0f;
+        float leave = 1f;
+        normal = Vector3.up;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            Vector3 direction = axis == 0 ? volume.axisX : axis == 1 ? volume.axisY : volume.axisZ;
+            float half = (axis == 0 ? volume.halfExtents.x : axis == 1 ? volume.halfExtents.y : volume.halfExtents.z) + r;
+            float start = Vector3.Dot(offset, direction);
+            float velocity = Vector3.Dot(d, direction);
+
+            if (Mathf.Abs(velocity) < 1e-9f)
+            {
+                if (Mathf.Abs(start) > half)
+                    return false;
+                continue;
+            }
+
+            float t0 = (-half - start) / velocity;
+            float t1 = (half - start) / velocity;
+            float sign = -1f;
+            if (t0 > t1)
+            {
+                float swap = t0;
+                t0 = t1;
+                t1 = swap;
+                sign = 1f;
+            }
+
+            if (t0 > enter)
+            {
+                enter = t0;
+                normal = direction * sign;
+            }
+            leave = Mathf.Min(leave, t1);
+            if (enter > leave)
+                return false;
+        }
+
+        fraction = enter;
+        return true;
+    }
+}
@@ -0,0 +1,489 @@
+using System;
+using System.Text;
+
+/// <summary>
+/// Forward-only JSON reader over raw UTF-8 bytes (for example a response's nativeData).
+/// Nothing is allocated while reading, except when a string value differs from the cached
+/// string passed in. Malformed input makes a call return false; it never throws.
+/// </summary>
+public ref struct JsonByteReader
+{
+    private const int MaxDepth = 32;
+
+    private readonly ReadOnlySpan<byte> json;
+    private char[] scratch; // Unescaped string characters; replaced (once) if a longer string turns up
+    private int position;
+
+    public JsonByteReader(ReadOnlySpan<byte> json, char[] scratch)
+    {
+        this.json = json;
+        this.scratch = scratch;
+        position = 0;
+    }
+
+    /// <summary>
+    /// Scratch buffer in use; keep it for the next reader if it had to grow
+    /// </summary>
+    public char[] Scratch => scratch;
+
+    public bool ReadObjectStart()
+    {
+        SkipWhitespace();
+        return Consume((byte)'{');
+    }
+
+    public bool ReadArrayStart()
+    {
+        SkipWhitespace();
+        return Consume((byte)'[');
+    }
+
+    /// <summary>
+    /// Move to the next member of the current object and leave the reader on its value.
+    /// Sets end instead after the closing brace. count is the number of members read so far.
+    /// </summary>
+    public bool NextProperty(ref int count, out ReadOnlySpan<byte> name, out bool end)
+    {
+        name = default;
+        end = false;
+
+        if (!NextItem(ref count, (byte)'}', out end))
+            return false;
+        if (end)
+            return true;
+
+        if (!ReadRawString(out name))
+            return false;
+
+        SkipWhitespace();
+        return Consume((byte)':');
+    }
+
+    /// <summary>
+    /// Move to the next element of the current array, or set end after the closing bracket
+    /// </summary>
+    public bool NextElement(ref int count, out bool end)
+    {
+        return NextItem(ref count, (byte)']', out end);
+    }
+
+    /// <summary>
+    /// True (and consumed) if the next value is the literal null
+    /// </summary>
+    public bool ReadNull()
+    {
+        SkipWhitespace();
+        return ConsumeLiteral("null");
+    }
+
+    public bool ReadInt(out int value)
+    {
+        value = 0;
+        if (ReadNull())
+            return true;
+
+        if (!ReadNumber(out double number) || number < int.MinValue || number > int.MaxValue)
+            return false;
+
+        value = (int)Math.Round(number);
+        return true;
+    }
+
+    public bool ReadFloat(out float value)
+    {
+        value = 0f;
+        if (ReadNull())
+            return true;
+
+        if (!ReadNumber(out double number))
+            return false;
+
+        value = (float)number;
+        return true;
+    }
+
+    public bool ReadBool(out bool value)
+    {
+        value = false;
+        SkipWhitespace();
+
+        if (ConsumeLiteral("true"))
+        {
+            value = true;
+            return true;
+        }
+        return ConsumeLiteral("false") || ConsumeLiteral("null");
+    }
+
+    /// <summary>
+    /// Read a string value into cached. A new string is only allocated when the text changed.
+    /// </summary>
+    public bool ReadString(ref string cached)
+    {
+        if (ReadNull())
+        {
+            cached = null;
+            return true;
+        }
+
+        if (!Consume((byte)'"'))
+            return false;
+
+        int length = 0;
+        while (true)
+        {
+            // Copy the run up to the next quote or escape in one go
+            int runStart = position;
+            while (position < json.Length && json[position] != (byte)'"' && json[position] != (byte)'\\')
+            {
+                if (json[position] < 0x20)
+                    return false;
+                position++;
+            }
+
+            if (position >= json.Length)
+                return false;
+
+            if (position > runStart)
+            {
+                ReadOnlySpan<byte> run = json.Slice(runStart, position - runStart);
+                EnsureScratch(length + run.Length);
+                length += Encoding.UTF8.GetChars(run, scratch.AsSpan(length));
+            }
+
+            if (json[position] == (byte)'"')
+            {
+                position++;
+                break;
+            }
+
+            // Escape sequence
+            position++;
+            if (position >= json.Length)
+                return false;
+
+            EnsureScratch(length + 1);
+            char escaped;
+            switch (json[position++])
+            {
+                case (byte)'"': escaped = '"'; break;
+                case (byte)'\\': escaped = '\\'; break;
+                case (byte)'/': escaped = '/'; break;
+                case (byte)'b': escaped = '\b'; break;
+                case (byte)'f': escaped = '\f'; break;
+                case (byte)'n': escaped = '\n'; break;
+                case (byte)'r': escaped = '\r'; break;
+                case (byte)'t': escaped = '\t'; break;
+                case (byte)'u':
+                    if (!ReadHex4(out escaped))
+                        return false;
+                    break;
+                default:
+                    return false;
+            }
+            scratch[length++] = escaped;
+        }
+
+        ReadOnlySpan<char> text = scratch.AsSpan(0, length);
+        if (cached == null || !text.SequenceEqual(cached.AsSpan()))
+            cached = text.ToString();
+        return true;
+    }
+
+    /// <summary>
+    /// The bytes between the quotes of a string value, without unescaping (for keys and IDs)
+    /// </summary>
+    public bool ReadRawString(out ReadOnlySpan<byte> value)
+    {
+        value = default;
+        SkipWhitespace();
+        if (!Consume((byte)'"'))
+            return false;
+
+        int start = position;
+        while (position < json.Length && json[position] != (byte)'"')
+        {
+            if (json[position] == (byte)'\\')
+                position++;
+            position++;
+        }
+
+        if (position >= json.Length)
+            return false;
+
+        value = json.Slice(start, position - start);
+        position++;
+        return true;
+    }
+
+    /// <summary>
+    /// Skip one value of any type, checking it is well formed
+    /// </summary>
+    public bool SkipValue()
+    {
+        return SkipValue(0);
+    }
+
+    /// <summary>
+    /// Skip one value and return its raw bytes, so it can be decoded later with another reader
+    /// </summary>
+    public bool SkipValue(out ReadOnlySpan<byte> raw)
+    {
+        SkipWhitespace();
+        int start = position;
+        bool ok = SkipValue(0);
+        raw = ok ? json.Slice(start, position - start) : default;
+        return ok;
+    }
+
+    /// <summary>
+    /// True if only whitespace remains
+    /// </summary>
+    public bool AtEnd()
+    {
+        SkipWhitespace();
+        return position == json.Length;
+    }
+
+    public static bool NameIs(ReadOnlySpan<byte> name, string ascii)
+    {
+        if (name.Length != ascii.Length)
+            return false;
+
+        for (int i = 0; i < name.Length; i++)
+        {
+            if (name[i] != ascii[i])
+                return false;
+        }
+        return true;
+    }
+
+    // Internals
+
+    private bool NextItem(ref int count, byte close, out bool end)
+    {
+        end = false;
+        SkipWhitespace();
+        if (position >= json.Length)
+            return false;
+
+        if (json[position] == close)
+        {
+            position++;
+            end = true;
+            return true;
+        }
+
+        if (count > 0 && !Consume((byte)','))
+            return false;
+
+        count++;
+        SkipWhitespace();
+        return position < json.Length && json[position] != close;
+    }
+
+    private bool SkipValue(int depth)
+    {
+        if (depth > MaxDepth)
+            return false;
+
+        SkipWhitespace();
+        if (position >= json.Length)
+            return false;
+
+        switch (json[position])
+        {
+            case (byte)'{':
+            {
+                position++;
+                int count = 0;
+                while (true)
+                {
+                    if (!NextProperty(ref count, out _, out bool end))
+                        return false;
+                    if (end)
+                        return true;
+                    if (!SkipValue(depth + 1))
+                        return false;
+                }
+            }
+            case (byte)'[':
+            {
+                position++;
+                int count = 0;
+                while (true)
+                {
+                    if (!NextElement(ref count, out bool end))
+                        return false;
+                    if (end)
+                        return true;
+                    if (!SkipValue(depth + 1))
+                        return false;
+                }
+            }
+            case (byte)'"':
+                return ReadRawString(out _);
+            case (byte)'t':
+                return ConsumeLiteral("true");
+            case (byte)'f':
+                return ConsumeLiteral("false");
+            case (byte)'n':
+                return ConsumeLiteral("null");
+            default:
+                return ReadNumber(out _);
+        }
+    }
+
+    private bool ReadNumber(out double value)
+    {
+        value = 0;
+        SkipWhitespace();
+
+        bool negative = Consume((byte)'-');
+        long mantissa = 0;
+        int digits = 0;
+        int exponent = 0;
+
+        while (position < json.Length && IsDigit(json[position]))
+        {
+            // Beyond 18 significant digits only the magnitude matters
+            if (digits < 18)
+                mantissa = mantissa * 10 + (json[position] - (byte)'0');
+            else
+                exponent++;
+            digits++;
+            position++;
+        }
+
+        if (digits == 0)
+            return false;
+
+        if (Consume((byte)'.'))
+        {
+            int fractionDigits = 0;
+            while (position < json.Length && IsDigit(json[position]))
+            {
+                if (digits < 18)
+                {
+                    mantissa = mantissa * 10 + (json[position] - (byte)'0');
+                    exponent--;
+                }
+                digits++;
+                fractionDigits++;
+                position++;
+            }
+
+            if (fractionDigits == 0)
+                return false;
+        }
+
+        if (position < json.Length && (json[position] == (byte)'e' || json[position] == (byte)'E'))
+        {
+            position++;
+            bool negativeExponent = Consume((byte)'-');
+            if (!negativeExponent)
+                Consume((byte)'+');
+
+            int exponentValue = 0;
+            int exponentDigits = 0;
+            while (position < json.Length && IsDigit(json[position]))
+            {
+                if (exponentValue < 1000)
+                    exponentValue = exponentValue * 10 + (json[position] - (byte)'0');
+                exponentDigits++;
+                position++;
+            }
+
+            if (exponentDigits == 0)
+                return false;
+
+            exponent += negativeExponent ? -exponentValue : exponentValue;
+        }
+
+        // Zero stays zero at any exponent (0 * 10^1000 would be NaN)
+        if (mantissa != 0)
+            value = exponent >= 0 ? mantissa * Math.Pow(10, exponent) : mantissa / Math.Pow(10, -exponent);
+        if (negative)
+            value = -value;
+        return !double.IsInfinity(value) && !double.IsNaN(value);
+    }
+
+    private bool ReadHex4(out char value)
+    {
+        value = '\0';
+        if (position + 4 > json.Length)
+            return false;
+
+        int code = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            byte b = json[position++];
+            int digit;
+            if (b >= (byte)'0' && b <= (byte)'9') digit = b - (byte)'0';
+            else if (b >= (byte)'a' && b <= (byte)'f') digit = b - (byte)'a' + 10;
+            else if (b >= (byte)'A' && b <= (byte)'F') digit = b - (byte)'A' + 10;
+            else return false;
+            code = code * 16 + digit;
+        }
+
+        value = (char)code;
+        return true;
+    }
+
+    private void EnsureScratch(int length)
+    {
+        if (scratch == null || scratch.Length < length)
+            Array.Resize(ref scratch, Math.Max(length, scratch == null ? 64 : scratch.Length * 2));
+    }
+
+    private bool ConsumeLiteral(string literal)
+    {
+        if (position + literal.Length > json.Length)
+            return false;
+
+        for (int i = 0; i < literal.Length; i++)
+        {
+            if (json[position + i] != literal[i])
+                return false;
+        }
+
+        // "nullx" or "true1" are not literals
+        int after = position + literal.Length;
+        if (after < json.Length && IsIdentifierByte(json[after]))
+            return false;
+
+        position = after;
+        return true;
+    }
+
+    private bool Consume(byte expected)
+    {
+        if (position < json.Length && json[position] == expected)
+        {
+            position++;
+            return true;
+        }
+        return false;
+    }
+
+    private void SkipWhitespace()
+    {
+        while (position < json.Length)
+        {
+            byte b = json[position];
+            if (b != (byte)' ' && b != (byte)'\t' && b != (byte)'\n' && b != (byte)'\r')
+                break;
+            position++;
+        }
+    }
+
+    private static bool IsDigit(byte b)
+    {
+        return b >= (byte)'0' && b <= (byte)'9';
+    }
+
+    private static bool IsIdentifierByte(byte b)
+    {
+        return IsDigit(b) || (b >= (byte)'a' && b <= (byte)'z') || (b >= (byte)'A' && b <= (byte)'Z');
+    }
+}
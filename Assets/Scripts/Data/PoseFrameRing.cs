@@ -0,0 +1,89 @@
+using System.Threading;
+using UnityEngine;
+
+/// <summary>
+/// Fixed-capacity single-producer/single-consumer ring buffer of pose frames: a time, a tracked
+/// mask and PoseRecording.FloatsPerPose floats per track. The producer (the main thread sampling
+/// transforms) and the consumer (a flush thread) never lock: each side only advances its own
+/// index. Nothing is allocated after construction.
+/// </summary>
+public class PoseFrameRing
+{
+    private readonly double[] times;
+    private readonly ulong[] trackedMasks;
+    private readonly float[] poses;
+    private readonly int stride;
+    private readonly int mask;
+
+    private long writeIndex; // Advanced only by the producer
+    private long readIndex;  // Advanced only by the consumer
+
+    public PoseFrameRing(int minCapacity, int trackCount)
+    {
+        int capacity = Mathf.NextPowerOfTwo(Mathf.Max(2, minCapacity));
+        stride = trackCount * PoseRecording.FloatsPerPose;
+        times = new double[capacity];
+        trackedMasks = new ulong[capacity];
+        poses = new float[capacity * stride];
+        mask = capacity - 1;
+    }
+
+    public int Capacity => times.Length;
+
+    /// <summary>
+    /// Floats per frame
+    /// </summary>
+    public int Stride => stride;
+
+    /// <summary>
+    /// Frames written but not yet read
+    /// </summary>
+    public int Count => (int)(Volatile.Read(ref writeIndex) - Volatile.Read(ref readIndex));
+
+    // Producer side
+
+    /// <summary>
+    /// Append one frame (Stride floats from frame); returns false (and drops it) if the buffer is full
+    /// </summary>
+    public bool TryWrite(double time, ulong tracked, float[] frame)
+    {
+        long write = writeIndex;
+        if (write - Volatile.Read(ref readIndex) >= times.Length)
+            return false;
+
+        int slot = (int)write & mask;
+        times[slot] = time;
+        trackedMasks[slot] = tracked;
+        System.Array.Copy(frame, 0, poses, slot * stride, stride);
+        Volatile.Write(ref writeIndex, write + 1);
+        return true;
+    }
+
+    // Consumer side
+
+    /// <summary>
+    /// Hand up to maxFrames pending frames to the writer; returns how many were moved
+    /// </summary>
+    public int ReadInto(PoseRecordingWriter writer, int maxFrames = int.MaxValue)
+    {
+        long read = readIndex;
+        int available = Mathf.Min((int)(Volatile.Read(ref writeIndex) - read), maxFrames);
+
+        for (int i = 0; i < available; i++)
+        {
+            int slot = (int)(read + i) & mask;
+            writer.AddFrame(times[slot], trackedMasks[slot], poses, slot * stride);
+        }
+
+        Volatile.Write(ref readIndex, read + available);
+        return available;
+    }
+
+    /// <summary>
+    /// Discard everything pending (consumer side)
+    /// </summary>
+    public void Clear()
+    {
+        Volatile.Write(ref readIndex, Volatile.Read(ref writeIndex));
+    }
+}
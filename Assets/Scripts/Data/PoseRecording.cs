@@ -0,0 +1,460 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.IO.Compression;
+using System.Text;
+
+/// <summary>
+/// Recorded head, hand and instrument poses for a training session.
+///
+/// Layout (little-endian):
+///   header  "PREC", version, track count, sample rate, position step, start time (Unix seconds, double),
+///           then each track's name (length-prefixed UTF-8)
+///   blocks  frame count, raw length, compressed length, first frame time (ticks, long),
+///           the count and names of tracks added since the previous block (version 2 on),
+///           then the frames, deflated
+///   frame   time since the previous frame in ticks, bitmask of tracked tracks, then for each tracked
+///           track the change in its quantized position (x, y, z) and rotation (x, y, z, w) since the
+///           previous frame of the block; all as (zig-zag) varints
+///
+/// Positions are stored in steps of positionStep metres and rotation components in 1/32767ths, so a
+/// still or slowly moving track costs a byte or two per component before compression. Each block
+/// starts from zero, so blocks decode independently, and a file cut short by a crash is readable up
+/// to its last complete block.
+/// </summary>
+public sealed class PoseRecording
+{
+    public const string Extension = ".prec";
+    public const int FloatsPerPose = 7; // Position xyz, rotation xyzw
+    public const int MaxTracks = 64;    // One bit each in a frame's tracked mask
+    public const double TicksPerSecond = 10000.0;
+
+    internal const int Magic = 0x43455250; // "PREC"
+    internal const int Version = 2;
+    internal const float RotationScale = 32767f;
+
+    private struct Block
+    {
+        public long offset; // Of the compressed bytes
+        public int frameCount;
+        public int rawLength;
+        public int compressedLength;
+        public long firstTicks;
+        public int firstFrame;
+    }
+
+    private readonly string path;
+    private readonly string[] trackNames;
+    private readonly List<Block> blocks;
+    private readonly float positionStep;
+    private byte[] raw = new byte[0];
+    private long[] previous;
+
+    public int TrackCount => trackNames.Length;
+    public float SampleRate { get; }
+    public int FrameCount { get; }
+    public int BlockCount => blocks.Count;
+
+    /// <summary>
+    /// Wall-clock time of the first frame, Unix seconds
+    /// </summary>
+    public double StartTime { get; }
+
+    /// <summary>
+    /// Seconds from the first frame to the last
+    /// </summary>
+    public double Duration { get; private set; }
+
+    private PoseRecording(string path, string[] trackNames, float sampleRate, float positionStep, double startTime, List<Block> blocks)
+    {
+        this.path = path;
+        this.trackNames = trackNames;
+        this.blocks = blocks;
+        this.positionStep = positionStep;
+        SampleRate = sampleRate;
+        StartTime = startTime;
+        previous = new long[trackNames.Length * FloatsPerPose];
+        foreach (Block block in blocks)
+            FrameCount += block.frameCount;
+    }
+
+    /// <summary>
+    /// Index a recording; null (with the reason in error) if it is missing or not a valid recording
+    /// </summary>
+    public static PoseRecording Open(string path, out string error)
+    {
+        error = null;
+        try
+        {
+            using (FileStream stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.ReadWrite))
+            using (BinaryReader reader = new BinaryReader(stream, Encoding.UTF8))
+            {
+                int version = 0;
+                if (stream.Length < 28 || reader.ReadInt32() != Magic || (version = reader.ReadInt32()) < 1 || version > Version)
+                {
+                    error = "not a version 1-" + Version + " pose recording";
+                    return null;
+                }
+
+                int trackCount = reader.ReadInt32();
+                float sampleRate = reader.ReadSingle();
+                float positionStep = reader.ReadSingle();
+                double startTime = reader.ReadDouble();
+                if (trackCount < 0 || trackCount > MaxTracks || positionStep <= 0f)
+                {
+                    error = "bad header";
+                    return null;
+                }
+
+                List<string> names = new List<string>(trackCount);
+                for (int i = 0; i < trackCount; i++)
+                    names.Add(reader.ReadString());
+
+                // Walk the block headers; stop at the first incomplete block
+                List<Block> blocks = new List<Block>();
+                List<string> addedNames = new List<string>();
+                int frames = 0;
+                while (stream.Length - stream.Position >= 20)
+                {
+                    Block block = new Block
+                    {
+                        frameCount = reader.ReadInt32(),
+                        rawLength = reader.ReadInt32(),
+                        compressedLength = reader.ReadInt32(),
+                        firstTicks = reader.ReadInt64(),
+                        firstFrame = frames
+                    };
+                    addedNames.Clear();
+                    if (version >= 2 && !ReadTrackNames(reader, addedNames, MaxTracks - names.Count))
+                        break;
+                    block.offset = stream.Position;
+                    if (block.frameCount <= 0 || block.rawLength < 0 || block.compressedLength < 0 || block.offset + block.compressedLength > stream.Length)
+                        break;
+
+                    names.AddRange(addedNames);
+                    blocks.Add(block);
+                    frames += block.frameCount;
+                    stream.Position += block.compressedLength;
+                }
+
+                PoseRecording recording = new PoseRecording(path, names.ToArray(), sampleRate, positionStep, startTime, blocks);
+                if (blocks.Count > 0)
+                {
+                    // The last frame's time is only known by decoding the last block
+                    double[] times = new double[blocks[blocks.Count - 1].frameCount];
+                    recording.ReadBlock(blocks.Count - 1, times, null, null);
+                    recording.Duration = times[times.Length - 1] - blocks[0].firstTicks / TicksPerSecond;
+                }
+                return recording;
+            }
+        }
+        catch (Exception e)
+        {
+            error = e.Message;
+            return null;
+        }
+    }
+
+    /// <summary>
+    /// Read a block's added track names; false if they are cut short or exceed room
+    /// </summary>
+    private static bool ReadTrackNames(BinaryReader reader, List<string> names, int room)
+    {
+        try
+        {
+            int count = reader.ReadInt32();
+            if (count < 0 || count > room)
+                return false;
+            for (int i = 0; i < count; i++)
+                names.Add(reader.ReadString());
+            return true;
+        }
+        catch (EndOfStreamException)
+        {
+            return false;
+        }
+    }
+
+    public string TrackName(int track)
+    {
+        return trackNames[track];
+    }
+
+    public int BlockFrameCount(int block)
+    {
+        return blocks[block].frameCount;
+    }
+
+    public int BlockFirstFrame(int block)
+    {
+        return blocks[block].firstFrame;
+    }
+
+    /// <summary>
+    /// Block holding the last frame at or before time (seconds since start), or -1 if none
+    /// </summary>
+    public int BlockAt(double time)
+    {
+        long ticks = (long)Math.Round(time * TicksPerSecond);
+        int low = 0, high = blocks.Count;
+        while (low < high)
+        {
+            int mid = (low + high) >> 1;
+            if (blocks[mid].firstTicks <= ticks)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        return low - 1;
+    }
+
+    /// <summary>
+    /// Decode one block. times gets seconds since start per frame, masks the tracked tracks per
+    /// frame, poses FloatsPerPose floats per track per frame (a track not tracked in a frame keeps its
+    /// last pose in the block, or zeros; so does a track added after the block). Any of the outputs
+    /// may be null. Returns the frame count.
+    /// </summary>
+    public int ReadBlock(int blockIndex, double[] times, ulong[] masks, float[] poses)
+    {
+        Block block = blocks[blockIndex];
+        if (raw.Length < block.rawLength)
+            raw = new byte[block.rawLength];
+
+        using (FileStream stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.ReadWrite))
+        {
+            stream.Position = block.offset;
+            using (DeflateStream inflate = new DeflateStream(stream, CompressionMode.Decompress))
+            {
+                int read = 0;
+                while (read < block.rawLength)
+                {
+                    int n = inflate.Read(raw, read, block.rawLength - read);
+                    if (n <= 0)
+                        throw new InvalidDataException("pose block truncated");
+                    read += n;
+                }
+            }
+        }
+
+        Array.Clear(previous, 0, previous.Length);
+        int trackCount = trackNames.Length;
+        int position = 0;
+        long ticks = block.firstTicks;
+        for (int frame = 0; frame < block.frameCount; frame++)
+        {
+            ticks += ReadSigned(raw, ref position);
+            ulong mask = ReadUnsigned(raw, ref position);
+            if (times != null)
+                times[frame] = ticks / TicksPerSecond;
+            if (masks != null)
+                masks[frame] = mask;
+
+            for (int track = 0; track < trackCount; track++)
+            {
+                int q = track * FloatsPerPose;
+                if ((mask & (1UL << track)) != 0)
+                {
+                    for (int c = 0; c < FloatsPerPose; c++)
+                        previous[q + c] += ReadSigned(raw, ref position);
+                }
+
+                if (poses != null)
+                {
+                    int p = (frame * trackCount + track) * FloatsPerPose;
+                    for (int c = 0; c < 3; c++)
+                        poses[p + c] = previous[q + c] * positionStep;
+                    for (int c = 3; c < FloatsPerPose; c++)
+                        poses[p + c] = previous[q + c] / RotationScale;
+                }
+            }
+        }
+        return block.frameCount;
+    }
+
+    internal static void WriteUnsigned(ref byte[] buffer, ref int length, ulong value)
+    {
+        if (length + 10 > buffer.Length)
+            Array.Resize(ref buffer, buffer.Length * 2);
+        while (value >= 0x80)
+        {
+            buffer[length++] = (byte)(value | 0x80);
+            value >>= 7;
+        }
+        buffer[length++] = (byte)value;
+    }
+
+    internal static void WriteSigned(ref byte[] buffer, ref int length, long value)
+    {
+        WriteUnsigned(ref buffer, ref length, (ulong)((value << 1) ^ (value >> 63)));
+    }
+
+    private static ulong ReadUnsigned(byte[] buffer, ref int position)
+    {
+        ulong value = 0;
+        int shift = 0;
+        byte b;
+        do
+        {
+            b = buffer[position++];
+            value |= (ulong)(b & 0x7F) << shift;
+            shift += 7;
+        } while ((b & 0x80) != 0);
+        return value;
+    }
+
+    private static long ReadSigned(byte[] buffer, ref int position)
+    {
+        ulong value = ReadUnsigned(buffer, ref position);
+        return (long)(value >> 1) ^ -(long)(value & 1);
+    }
+}
+
+/// <summary>
+/// Writes a PoseRecording. Frames are delta-encoded into a block buffer and each full block is
+/// deflated and appended, so memory stays at one block however long the session runs.
+/// Tracks can be added while writing; their names go in the header of the next block.
+/// Not thread-safe; PoseRecorder drives it from its flush thread.
+/// </summary>
+public sealed class PoseRecordingWriter : IDisposable
+{
+    private readonly FileStream stream;
+    private readonly BinaryWriter writer;
+    private int trackCount;
+    private readonly List<string> addedTrackNames = new List<string>(); // Since the last block
+    private readonly float inversePositionStep;
+    private readonly int framesPerBlock;
+    private readonly long[] previous;
+    private readonly MemoryStream compressed = new MemoryStream();
+    private byte[] block = new byte[16384];
+    private int blockLength = 0;
+    private int blockFrames = 0;
+    private long blockFirstTicks = 0;
+    private long lastTicks = long.MinValue;
+    private int frameCount = 0;
+
+    /// <summary>
+    /// positionStep is the size of one position step in metres; the default keeps 0.1 mm
+    /// </summary>
+    public PoseRecordingWriter(string path, double startTime, float sampleRate, string[] trackNames, float positionStep = 1e-4f, int framesPerBlock = 512)
+    {
+        if (trackNames.Length > PoseRecording.MaxTracks)
+            throw new ArgumentException($"at most {PoseRecording.MaxTracks} tracks");
+
+        Directory.CreateDirectory(Path.GetDirectoryName(Path.GetFullPath(path)));
+        stream = new FileStream(path, FileMode.Create, FileAccess.Write, FileShare.Read);
+        writer = new BinaryWriter(stream, Encoding.UTF8);
+        trackCount = trackNames.Length;
+        inversePositionStep = 1f / positionStep;
+        this.framesPerBlock = Math.Max(1, framesPerBlock);
+        previous = new long[PoseRecording.MaxTracks * PoseRecording.FloatsPerPose];
+
+        writer.Write(PoseRecording.Magic);
+        writer.Write(PoseRecording.Version);
+        writer.Write(trackCount);
+        writer.Write(sampleRate);
+        writer.Write(positionStep);
+        writer.Write(startTime);
+        foreach (string name in trackNames)
+            writer.Write(name ?? string.Empty);
+    }
+
+    public int FrameCount => frameCount;
+    public int TrackCount => trackCount;
+    public long BytesWritten => stream.Position;
+
+    /// <summary>
+    /// Add a track after the last; frames from now on may include it in their tracked mask
+    /// </summary>
+    public void AddTrack(string name)
+    {
+        if (trackCount == PoseRecording.MaxTracks)
+            throw new InvalidOperationException($"at most {PoseRecording.MaxTracks} tracks");
+
+        // Frames already in the block were encoded without it; the name must precede its first use
+        FlushBlock();
+        addedTrackNames.Add(name ?? string.Empty);
+        trackCount++;
+    }
+
+    /// <summary>
+    /// Add a frame at time seconds since the start; frames must be in time order. poses holds
+    /// PoseRecording.FloatsPerPose floats per track from offset; tracks not in trackedMask are skipped.
+    /// </summary>
+    public bool AddFrame(double time, ulong trackedMask, float[] poses, int offset)
+    {
+        long ticks = (long)Math.Round(time * PoseRecording.TicksPerSecond);
+        if (ticks <= lastTicks)
+            return false;
+
+        if (blockFrames == 0)
+        {
+            blockFirstTicks = ticks;
+            lastTicks = ticks;
+            Array.Clear(previous, 0, previous.Length);
+        }
+
+        PoseRecording.WriteSigned(ref block, ref blockLength, ticks - lastTicks);
+        PoseRecording.WriteUnsigned(ref block, ref blockLength, trackedMask);
+        lastTicks = ticks;
+
+        for (int track = 0; track < trackCount; track++)
+        {
+            if ((trackedMask & (1UL << track)) == 0)
+                continue;
+
+            int p = offset + track * PoseRecording.FloatsPerPose;
+            int q = track * PoseRecording.FloatsPerPose;
+            for (int c = 0; c < 3; c++)
+                Encode(q + c, (long)Math.Round(poses[p + c] * inversePositionStep));
+
+            // q and -q are the same rotation; keep the sign continuous so deltas stay small
+            float sign = 1f;
+            if (previous[q + 3] * poses[p + 3] + previous[q + 4] * poses[p + 4] + previous[q + 5] * poses[p + 5] + previous[q + 6] * poses[p + 6] < 0f)
+                sign = -1f;
+            for (int c = 3; c < PoseRecording.FloatsPerPose; c++)
+                Encode(q + c, (long)Math.Round(sign * poses[p + c] * PoseRecording.RotationScale));
+        }
+
+        frameCount++;
+        if (++blockFrames >= framesPerBlock)
+            FlushBlock();
+        return true;
+    }
+
+    public void Dispose()
+    {
+        FlushBlock();
+        writer.Dispose();
+        compressed.Dispose();
+    }
+
+    private void Encode(int component, long value)
+    {
+        PoseRecording.WriteSigned(ref block, ref blockLength, value - previous[component]);
+        previous[component] = value;
+    }
+
+    private void FlushBlock()
+    {
+        if (blockFrames == 0)
+            return;
+
+        compressed.SetLength(0);
+        using (DeflateStream deflate = new DeflateStream(compressed, CompressionLevel.Optimal, true))
+            deflate.Write(block, 0, blockLength);
+
+        writer.Write(blockFrames);
+        writer.Write(blockLength);
+        writer.Write((int)compressed.Length);
+        writer.Write(blockFirstTicks);
+        writer.Write(addedTrackNames.Count);
+        foreach (string name in addedTrackNames)
+            writer.Write(name);
+        addedTrackNames.Clear();
+        writer.Write(compressed.GetBuffer(), 0, (int)compressed.Length);
+        writer.Flush();
+
+        blockLength = 0;
+        blockFrames = 0;
+    }
+}
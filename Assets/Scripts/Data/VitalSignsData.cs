@@ -30,4 +30,17 @@ public class BloodPressure
 {
     public int diastolic;
     public int systolic;
+}
+
+[Serializable]
+public class VitalSignsBatchResponse
+{
+    public VitalSignsBatchEntry[] monitors;
+}
+
+[Serializable]
+public class VitalSignsBatchEntry
+{
+    public string monitorId;
+    public VitalSignsData data;
 }
\ No newline at end of file
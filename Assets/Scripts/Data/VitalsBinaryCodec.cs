@@ -0,0 +1,283 @@
+using System;
+using System.Text;
+
+/// <summary>
+/// Compact binary encoding of VitalSignsData, negotiated with "accept: application/x-vitals-delta".
+///
+/// Frame: 'V' 'D', version, flags, sequence (u32), base sequence (u32), change mask (u16), then one
+/// value per set mask bit in field order. Numbers are zigzag varints; in a delta frame they are the
+/// difference from the base sample the client last acknowledged (sent back in X-Vitals-Base).
+/// Strings are a length byte plus UTF-8 and are only present when they changed.
+/// A full frame sets every bit and encodes against an all-zero base.
+/// </summary>
+public static class VitalsBinaryCodec
+{
+    public const string ContentType = "application/x-vitals-delta";
+    public const string BaseHeader = "X-Vitals-Base";
+    public const int MaxFrameSize = HeaderSize + NumericFieldCount * 5 + StringFieldCount * 256;
+
+    private const byte Magic0 = (byte)'V';
+    private const byte Magic1 = (byte)'D';
+    private const byte Version = 1;
+    private const byte FlagDelta = 1;
+    private const int HeaderSize = 14;
+
+    // Field order in the change mask; numeric fields first, then strings
+    private const int BatteryLevel = 0, BedOccupancy = 1, Systolic = 2, Diastolic = 3, Glucose = 4, HeartRate = 5;
+    private const int OxygenLevel = 6, RespiratoryRate = 7, SignalStrength = 8, Temperature = 9;
+    private const int DeviceStatus = 10, PatientId = 11, Timestamp = 12;
+    private const int NumericFieldCount = 10, StringFieldCount = 3;
+
+    /// <summary>
+    /// Encode current into buffer (at least MaxFrameSize bytes), as a delta against baseline when one is
+    /// given. Returns the frame length.
+    /// </summary>
+    public static int Encode(VitalSignsData current, uint sequence, VitalSignsData baseline, uint baseSequence, byte[] buffer)
+    {
+        bool delta = baseline != null;
+        int[] values = new int[NumericFieldCount];
+        int[] baseValues = new int[NumericFieldCount];
+        ReadNumbers(current, values);
+        if (delta)
+            ReadNumbers(baseline, baseValues);
+
+        int mask = 0;
+        for (int f = 0; f < NumericFieldCount; f++)
+        {
+            if (!delta || values[f] != baseValues[f])
+                mask |= 1 << f;
+        }
+        if (!delta || current.deviceStatus != baseline.deviceStatus) mask |= 1 << DeviceStatus;
+        if (!delta || current.patientId != baseline.patientId) mask |= 1 << PatientId;
+        if (!delta || current.timestamp != baseline.timestamp) mask |= 1 << Timestamp;
+
+        buffer[0] = Magic0;
+        buffer[1] = Magic1;
+        buffer[2] = Version;
+        buffer[3] = delta ? FlagDelta : (byte)0;
+        WriteUInt32(buffer, 4, sequence);
+        WriteUInt32(buffer, 8, delta ? baseSequence : 0);
+        buffer[12] = (byte)mask;
+        buffer[13] = (byte)(mask >> 8);
+
+        int position = HeaderSize;
+        for (int f = 0; f < NumericFieldCount; f++)
+        {
+            if ((mask & (1 << f)) != 0)
+                position = WriteVarint(buffer, position, values[f] - baseValues[f]);
+        }
+        if ((mask & (1 << DeviceStatus)) != 0) position = WriteString(buffer, position, current.deviceStatus);
+        if ((mask & (1 << PatientId)) != 0) position = WriteString(buffer, position, current.patientId);
+        if ((mask & (1 << Timestamp)) != 0) position = WriteString(buffer, position, current.timestamp);
+
+        return position;
+    }
+
+    /// <summary>
+    /// Apply a frame to target. sequence is the sample target currently holds (0 for none) and is
+    /// advanced on success. Returns false, leaving target untouched, for a malformed frame or a delta
+    /// against a different base; the caller should then ask for a full frame.
+    /// </summary>
+    public static bool TryDecode(ReadOnlySpan<byte> frame, VitalSignsData target, ref uint sequence)
+    {
+        if (frame.Length < HeaderSize || frame[0] != Magic0 || frame[1] != Magic1 || frame[2] != Version)
+            return false;
+
+        bool delta = (frame[3] & FlagDelta) != 0;
+        uint frameSequence = ReadUInt32(frame, 4);
+        uint baseSequence = ReadUInt32(frame, 8);
+        int mask = frame[12] | (frame[13] << 8);
+
+        if (delta && (sequence == 0 || baseSequence != sequence))
+            return false;
+
+        // Decode into locals first so a truncated frame changes nothing
+        int batteryLevel = 0, bedOccupancy = 0, systolic = 0, diastolic = 0, glucose = 0, heartRate = 0;
+        int oxygenLevel = 0, respiratoryRate = 0, signalStrength = 0, temperature = 0;
+        string deviceStatus = null, patientId = null, timestamp = null;
+
+        if (delta)
+        {
+            batteryLevel = target.batteryLevel;
+            bedOccupancy = target.bedOccupancy ? 1 : 0;
+            systolic = target.bloodPressure != null ? target.bloodPressure.systolic : 0;
+            diastolic = target.bloodPressure != null ? target.bloodPressure.diastolic : 0;
+            glucose = target.glucose;
+            heartRate = target.heartRate;
+            oxygenLevel = target.oxygenLevel;
+            respiratoryRate = target.respiratoryRate;
+            signalStrength = target.signalStrength;
+            temperature = (int)Math.Round(target.temperature * 100f);
+            deviceStatus = target.deviceStatus;
+            patientId = target.patientId;
+            timestamp = target.timestamp;
+        }
+
+        int position = HeaderSize;
+        bool ok = true;
+        if ((mask & (1 << BatteryLevel)) != 0) ok &= ReadVarint(frame, ref position, ref batteryLevel);
+        if ((mask & (1 << BedOccupancy)) != 0) ok &= ReadVarint(frame, ref position, ref bedOccupancy);
+        if ((mask & (1 << Systolic)) != 0) ok &= ReadVarint(frame, ref position, ref systolic);
+        if ((mask & (1 << Diastolic)) != 0) ok &= ReadVarint(frame, ref position, ref diastolic);
+        if ((mask & (1 << Glucose)) != 0) ok &= ReadVarint(frame, ref position, ref glucose);
+        if ((mask & (1 << HeartRate)) != 0) ok &= ReadVarint(frame, ref position, ref heartRate);
+        if ((mask & (1 << OxygenLevel)) != 0) ok &= ReadVarint(frame, ref position, ref oxygenLevel);
+        if ((mask & (1 << RespiratoryRate)) != 0) ok &= ReadVarint(frame, ref position, ref respiratoryRate);
+        if ((mask & (1 << SignalStrength)) != 0) ok &= ReadVarint(frame, ref position, ref signalStrength);
+        if ((mask & (1 << Temperature)) != 0) ok &= ReadVarint(frame, ref position, ref temperature);
+        if ((mask & (1 << DeviceStatus)) != 0) ok &= ReadString(frame, ref position, ref deviceStatus);
+        if ((mask & (1 << PatientId)) != 0) ok &= ReadString(frame, ref position, ref patientId);
+        if ((mask & (1 << Timestamp)) != 0) ok &= ReadString(frame, ref position, ref timestamp);
+
+        if (!ok || position != frame.Length)
+            return false;
+
+        if (target.bloodPressure == null)
+            target.bloodPressure = new BloodPressure();
+
+        target.batteryLevel = batteryLevel;
+        target.bedOccupancy = bedOccupancy != 0;
+        target.bloodPressure.systolic = systolic;
+        target.bloodPressure.diastolic = diastolic;
+        target.glucose = glucose;
+        target.heartRate = heartRate;
+        target.oxygenLevel = oxygenLevel;
+        target.respiratoryRate = respiratoryRate;
+        target.signalStrength = signalStrength;
+        target.temperature = temperature / 100f;
+        target.deviceStatus = deviceStatus;
+        target.patientId = patientId;
+        target.timestamp = timestamp;
+
+        sequence = frameSequence;
+        return true;
+    }
+
+    private static void ReadNumbers(VitalSignsData data, int[] values)
+    {
+        values[BatteryLevel] = data.batteryLevel;
+        values[BedOccupancy] = data.bedOccupancy ? 1 : 0;
+        values[Systolic] = data.bloodPressure != null ? data.bloodPressure.systolic : 0;
+        values[Diastolic] = data.bloodPressure != null ? data.bloodPressure.diastolic : 0;
+        values[Glucose] = data.glucose;
+        values[HeartRate] = data.heartRate;
+        values[OxygenLevel] = data.oxygenLevel;
+        values[RespiratoryRate] = data.respiratoryRate;
+        values[SignalStrength] = data.signalStrength;
+        values[Temperature] = (int)Math.Round(data.temperature * 100f); // Hundredths of a degree
+    }
+
+    // Primitives
+
+    private static int WriteVarint(byte[] buffer, int position, int value)
+    {
+        uint zigzag = (uint)((value << 1) ^ (value >> 31));
+        while (zigzag >= 0x80)
+        {
+            buffer[position++] = (byte)(zigzag | 0x80);
+            zigzag >>= 7;
+        }
+        buffer[position++] = (byte)zigzag;
+        return position;
+    }
+
+    /// <summary>
+    /// Adds the decoded difference to value
+    /// </summary>
+    private static bool ReadVarint(ReadOnlySpan<byte> frame, ref int position, ref int value)
+    {
+        uint zigzag = 0;
+        for (int shift = 0; shift < 35; shift += 7)
+        {
+            if (position >= frame.Length)
+                return false;
+
+            byte b = frame[position++];
+            zigzag |= (uint)(b & 0x7f) << shift;
+            if ((b & 0x80) == 0)
+            {
+                value += (int)(zigzag >> 1) ^ -(int)(zigzag & 1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    private static int WriteString(byte[] buffer, int position, string value)
+    {
+        // 0 = null, otherwise UTF-8 length + 1 (values are cut at 254 bytes)
+        if (value == null)
+        {
+            buffer[position++] = 0;
+            return position;
+        }
+
+        byte[] bytes = Encoding.UTF8.GetBytes(value);
+        int length = Math.Min(bytes.Length, 254);
+        if (length < bytes.Length)
+        {
+            // Back up over continuation bytes (10xxxxxx) so the cut falls before a whole character
+            while (length > 0 && (bytes[length] & 0xC0) == 0x80)
+                length--;
+        }
+        buffer[position++] = (byte)(length + 1);
+        Array.Copy(bytes, 0, buffer, position, length);
+        return position + length;
+    }
+
+    /// <summary>
+    /// Reuses value when the text is unchanged, so only real changes allocate
+    /// </summary>
+    private static bool ReadString(ReadOnlySpan<byte> frame, ref int position, ref string value)
+    {
+        if (position >= frame.Length)
+            return false;
+
+        int length = frame[position++];
+        if (length == 0)
+        {
+            value = null;
+            return true;
+        }
+
+        length--;
+        if (position + length > frame.Length)
+            return false;
+
+        ReadOnlySpan<byte> bytes = frame.Slice(position, length);
+        position += length;
+
+        if (value != null && SameText(bytes, value))
+            return true;
+
+        value = Encoding.UTF8.GetString(bytes);
+        return true;
+    }
+
+    private static bool SameText(ReadOnlySpan<byte> utf8, string text)
+    {
+        // Fast path for ASCII, which is all the backend sends
+        if (utf8.Length != text.Length)
+            return false;
+
+        for (int i = 0; i < utf8.Length; i++)
+        {
+            if (utf8[i] >= 0x80 || utf8[i] != text[i])
+                return false;
+        }
+        return true;
+    }
+
+    private static void WriteUInt32(byte[] buffer, int position, uint value)
+    {
+        buffer[position] = (byte)value;
+        buffer[position + 1] = (byte)(value >> 8);
+        buffer[position + 2] = (byte)(value >> 16);
+        buffer[position + 3] = (byte)(value >> 24);
+    }
+
+    private static uint ReadUInt32(ReadOnlySpan<byte> frame, int position)
+    {
+        return (uint)(frame[position] | (frame[position + 1] << 8) | (frame[position + 2] << 16) | (frame[position + 3] << 24));
+    }
+}
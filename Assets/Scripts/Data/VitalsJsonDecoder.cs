@@ -0,0 +1,267 @@
+using System;
+
+/// <summary>
+/// Decodes vitals payloads straight from response bytes into caller-owned VitalSignsData objects
+/// that are reused poll after poll. No intermediate string or object graph is built, and string
+/// fields only allocate when their text actually changed (typically just the timestamp).
+/// A payload is applied all-or-nothing: malformed input returns false and leaves the target untouched.
+/// </summary>
+public class VitalsJsonDecoder
+{
+    /// <summary>
+    /// Object to decode a monitor's entry into, or null to skip that monitor
+    /// </summary>
+    public delegate VitalSignsData TargetLookup(ReadOnlySpan<byte> monitorId);
+
+    private char[] scratch = new char[128];
+    private readonly VitalSignsData pending = new VitalSignsData { bloodPressure = new BloodPressure() };
+
+    // Bit flags for string fields seen in the current payload
+    private const int SeenDeviceStatus = 1, SeenPatientId = 2, SeenTimestamp = 4;
+
+    /// <summary>
+    /// VitalSignsResponse: { "timestamp", "data": { ... }, "patientId" }
+    /// </summary>
+    public bool TryDecodeResponse(ReadOnlySpan<byte> json, VitalSignsData target)
+    {
+        JsonByteReader reader = new JsonByteReader(json, scratch);
+        bool decoded = false;
+        bool ok = reader.ReadObjectStart();
+        int count = 0;
+
+        while (ok)
+        {
+            ok = reader.NextProperty(ref count, out ReadOnlySpan<byte> name, out bool end);
+            if (!ok || end)
+                break;
+
+            if (JsonByteReader.NameIs(name, "data"))
+            {
+                ok = DecodeData(ref reader, target);
+                decoded = ok;
+            }
+            else
+            {
+                ok = reader.SkipValue();
+            }
+        }
+
+        ok = ok && reader.AtEnd();
+        scratch = reader.Scratch;
+
+        if (ok && decoded)
+        {
+            Commit(target);
+            return true;
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// VitalSignsBatchResponse: { "monitors": [ { "monitorId", "data" }, ... ] }.
+    /// Each decoded entry is passed to onDecoded. Returns the number of entries applied, or -1 if malformed
+    /// (entries before the error have already been applied).
+    /// </summary>
+    public int TryDecodeBatch(ReadOnlySpan<byte> json, TargetLookup lookup, Action<VitalSignsData> onDecoded)
+    {
+        JsonByteReader reader = new JsonByteReader(json, scratch);
+        int applied = 0;
+        bool ok = reader.ReadObjectStart();
+        int count = 0;
+
+        while (ok)
+        {
+            ok = reader.NextProperty(ref count, out ReadOnlySpan<byte> name, out bool end);
+            if (!ok || end)
+                break;
+
+            if (!JsonByteReader.NameIs(name, "monitors") || reader.ReadNull())
+            {
+                ok = reader.SkipValue();
+                continue;
+            }
+
+            ok = reader.ReadArrayStart();
+            int elements = 0;
+            while (ok)
+            {
+                ok = reader.NextElement(ref elements, out bool arrayEnd);
+                if (!ok || arrayEnd)
+                    break;
+
+                ok = DecodeEntry(ref reader, lookup, onDecoded, ref applied);
+            }
+        }
+
+        ok = ok && reader.AtEnd();
+        scratch = reader.Scratch;
+        return ok ? applied : -1;
+    }
+
+    /// <summary>
+    /// A single VitalSignsBatchEntry, as pushed on the vitals stream
+    /// </summary>
+    public bool TryDecodeEntry(ReadOnlySpan<byte> json, TargetLookup lookup, Action<VitalSignsData> onDecoded)
+    {
+        JsonByteReader reader = new JsonByteReader(json, scratch);
+        int applied = 0;
+        bool ok = DecodeEntry(ref reader, lookup, onDecoded, ref applied) && reader.AtEnd();
+        scratch = reader.Scratch;
+        return ok;
+    }
+
+    private bool DecodeEntry(ref JsonByteReader reader, TargetLookup lookup, Action<VitalSignsData> onDecoded, ref int applied)
+    {
+        if (!reader.ReadObjectStart())
+            return false;
+
+        // Members may come in any order, so find both before decoding
+        ReadOnlySpan<byte> monitorId = default;
+        ReadOnlySpan<byte> data = default;
+        bool hasMonitorId = false, hasData = false;
+        int count = 0;
+
+        while (true)
+        {
+            if (!reader.NextProperty(ref count, out ReadOnlySpan<byte> name, out bool end))
+                return false;
+            if (end)
+                break;
+
+            bool ok;
+            if (JsonByteReader.NameIs(name, "monitorId"))
+                ok = hasMonitorId = reader.ReadRawString(out monitorId);
+            else if (JsonByteReader.NameIs(name, "data"))
+                ok = hasData = reader.SkipValue(out data);
+            else
+                ok = reader.SkipValue();
+
+            if (!ok)
+                return false;
+        }
+
+        if (!hasMonitorId || !hasData)
+            return true;
+
+        VitalSignsData target = lookup(monitorId);
+        if (target == null)
+            return true;
+
+        scratch = reader.Scratch;
+        JsonByteReader dataReader = new JsonByteReader(data, scratch);
+        bool decoded = DecodeData(ref dataReader, target);
+        scratch = dataReader.Scratch;
+
+        if (!decoded)
+            return false;
+
+        Commit(target);
+        applied++;
+        onDecoded?.Invoke(target);
+        return true;
+    }
+
+    /// <summary>
+    /// Decode a VitalSignsData object into pending. Strings start from the target's current values
+    /// so unchanged text is reused rather than reallocated.
+    /// </summary>
+    private bool DecodeData(ref JsonByteReader reader, VitalSignsData target)
+    {
+        if (reader.ReadNull() || !reader.ReadObjectStart())
+            return false;
+
+        pending.batteryLevel = 0;
+        pending.bedOccupancy = false;
+        pending.bloodPressure.systolic = 0;
+        pending.bloodPressure.diastolic = 0;
+        pending.glucose = 0;
+        pending.heartRate = 0;
+        pending.oxygenLevel = 0;
+        pending.respiratoryRate = 0;
+        pending.signalStrength = 0;
+        pending.temperature = 0f;
+        pending.deviceStatus = target.deviceStatus;
+        pending.patientId = target.patientId;
+        pending.timestamp = target.timestamp;
+
+        int seen = 0;
+        int count = 0;
+
+        while (true)
+        {
+            if (!reader.NextProperty(ref count, out ReadOnlySpan<byte> name, out bool end))
+                return false;
+            if (end)
+                break;
+
+            bool ok;
+            if (JsonByteReader.NameIs(name, "heartRate")) ok = reader.ReadInt(out pending.heartRate);
+            else if (JsonByteReader.NameIs(name, "oxygenLevel")) ok = reader.ReadInt(out pending.oxygenLevel);
+            else if (JsonByteReader.NameIs(name, "respiratoryRate")) ok = reader.ReadInt(out pending.respiratoryRate);
+            else if (JsonByteReader.NameIs(name, "temperature")) ok = reader.ReadFloat(out pending.temperature);
+            else if (JsonByteReader.NameIs(name, "glucose")) ok = reader.ReadInt(out pending.glucose);
+            else if (JsonByteReader.NameIs(name, "batteryLevel")) ok = reader.ReadInt(out pending.batteryLevel);
+            else if (JsonByteReader.NameIs(name, "signalStrength")) ok = reader.ReadInt(out pending.signalStrength);
+            else if (JsonByteReader.NameIs(name, "bedOccupancy")) ok = reader.ReadBool(out pending.bedOccupancy);
+            else if (JsonByteReader.NameIs(name, "bloodPressure")) ok = DecodeBloodPressure(ref reader);
+            else if (JsonByteReader.NameIs(name, "deviceStatus")) { ok = reader.ReadString(ref pending.deviceStatus); seen |= SeenDeviceStatus; }
+            else if (JsonByteReader.NameIs(name, "patientId")) { ok = reader.ReadString(ref pending.patientId); seen |= SeenPatientId; }
+            else if (JsonByteReader.NameIs(name, "timestamp")) { ok = reader.ReadString(ref pending.timestamp); seen |= SeenTimestamp; }
+            else ok = reader.SkipValue();
+
+            if (!ok)
+                return false;
+        }
+
+        // Missing members read as defaults, as with JsonUtility
+        if ((seen & SeenDeviceStatus) == 0) pending.deviceStatus = null;
+        if ((seen & SeenPatientId) == 0) pending.patientId = null;
+        if ((seen & SeenTimestamp) == 0) pending.timestamp = null;
+        return true;
+    }
+
+    private bool DecodeBloodPressure(ref JsonByteReader reader)
+    {
+        if (reader.ReadNull())
+            return true;
+        if (!reader.ReadObjectStart())
+            return false;
+
+        int count = 0;
+        while (true)
+        {
+            if (!reader.NextProperty(ref count, out ReadOnlySpan<byte> name, out bool end))
+                return false;
+            if (end)
+                return true;
+
+            bool ok;
+            if (JsonByteReader.NameIs(name, "systolic")) ok = reader.ReadInt(out pending.bloodPressure.systolic);
+            else if (JsonByteReader.NameIs(name, "diastolic")) ok = reader.ReadInt(out pending.bloodPressure.diastolic);
+            else ok = reader.SkipValue();
+
+            if (!ok)
+                return false;
+        }
+    }
+
+    private void Commit(VitalSignsData target)
+    {
+        if (target.bloodPressure == null)
+            target.bloodPressure = new BloodPressure();
+
+        target.batteryLevel = pending.batteryLevel;
+        target.bedOccupancy = pending.bedOccupancy;
+        target.bloodPressure.systolic = pending.bloodPressure.systolic;
+        target.bloodPressure.diastolic = pending.bloodPressure.diastolic;
+        target.deviceStatus = pending.deviceStatus;
+        target.glucose = pending.glucose;
+        target.heartRate = pending.heartRate;
+        target.oxygenLevel = pending.oxygenLevel;
+        target.patientId = pending.patientId;
+        target.respiratoryRate = pending.respiratoryRate;
+        target.signalStrength = pending.signalStrength;
+        target.temperature = pending.temperature;
+        target.timestamp = pending.timestamp;
+    }
+}
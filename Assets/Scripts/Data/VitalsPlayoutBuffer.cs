@@ -0,0 +1,224 @@
+using System;
+using System.Globalization;
+
+/// <summary>
+/// Playout (jitter) buffer between bursty vitals updates and per-frame displays.
+/// Each update is copied in with a presentation time: its source timestamp mapped onto the local
+/// clock, or its arrival time when it has none. Displays sample the buffer at (now - delay) and get
+/// values interpolated between the samples on either side, so a late or clustered response shifts
+/// nothing on screen as long as it arrives within the delay. Past the newest sample values are
+/// extrapolated for a short while and then held. Playout time never runs backwards.
+/// </summary>
+public class VitalsPlayoutBuffer
+{
+    public const int ChannelCount = VitalsTimeSeries.ChannelCount;
+
+    /// <summary>
+    /// Seconds between a sample's presentation time and when it is shown. Should exceed the update
+    /// interval plus its jitter so there is always a next sample to interpolate towards.
+    /// </summary>
+    public double delay;
+
+    /// <summary>
+    /// How far past the newest sample the trend is continued before values are held
+    /// </summary>
+    public double maxExtrapolation;
+
+    private readonly double[] times;
+    private readonly float[][] values; // [slot][channel]
+    private readonly float[] output = new float[ChannelCount];
+    private int head = 0;  // Next slot to write
+    private int count = 0;
+    private double lastPlayout = double.NegativeInfinity;
+
+    // Source clock -> local clock
+    private bool hasOffset = false;
+    private double offset;
+    private double lastSourceTime;
+    private string lastTimestamp;
+
+    private const double OffsetFollowRate = 0.05; // Share of an increased delay adopted per sample
+    private const double MinSpacing = 0.001;
+
+    public VitalsPlayoutBuffer(double delay, double maxExtrapolation = 2.0, int capacity = 16)
+    {
+        this.delay = delay;
+        this.maxExtrapolation = maxExtrapolation;
+        times = new double[Math.Max(2, capacity)];
+        values = new float[times.Length][];
+        for (int i = 0; i < values.Length; i++)
+            values[i] = new float[ChannelCount];
+    }
+
+    public bool HasData => count > 0;
+
+    /// <summary>
+    /// Add an update that arrived at arrivalTime (local clock, seconds).
+    /// Returns false if it repeats the previous reading.
+    /// </summary>
+    public bool Push(double arrivalTime, VitalSignsData vitals)
+    {
+        if (vitals == null)
+            return false;
+
+        // The decoders keep the same string when the text did not change, so this is usually a reference check
+        if (vitals.timestamp != null && vitals.timestamp == lastTimestamp)
+            return false;
+        lastTimestamp = vitals.timestamp;
+
+        // A newer reading always lands after the previous one, even if a faster delivery just
+        // lowered the transit estimate
+        double time = PresentationTime(arrivalTime, vitals.timestamp);
+        if (count > 0 && time <= times[Newest()])
+            time = times[Newest()] + MinSpacing;
+
+        times[head] = time;
+        float[] slot = values[head];
+        slot[(int)VitalChannel.HeartRate] = vitals.heartRate;
+        slot[(int)VitalChannel.OxygenLevel] = vitals.oxygenLevel;
+        slot[(int)VitalChannel.Systolic] = vitals.bloodPressure != null ? vitals.bloodPressure.systolic : 0f;
+        slot[(int)VitalChannel.Diastolic] = vitals.bloodPressure != null ? vitals.bloodPressure.diastolic : 0f;
+        slot[(int)VitalChannel.RespiratoryRate] = vitals.respiratoryRate;
+        slot[(int)VitalChannel.Temperature] = vitals.temperature;
+        slot[(int)VitalChannel.Glucose] = vitals.glucose;
+
+        head = (head + 1) % times.Length;
+        if (count < times.Length)
+            count++;
+        return true;
+    }
+
+    /// <summary>
+    /// Compute the values to show at local time now. Read them with Get afterwards.
+    /// Sampling repeatedly at the same time is cheap and returns the same values.
+    /// </summary>
+    public bool Sample(double now)
+    {
+        if (count == 0)
+            return false;
+
+        double playout = Math.Max(now - delay, lastPlayout);
+        lastPlayout = playout;
+
+        int oldest = Oldest();
+        int newest = Newest();
+
+        if (playout <= times[oldest])
+        {
+            Array.Copy(values[oldest], output, ChannelCount);
+            return true;
+        }
+
+        if (playout >= times[newest])
+        {
+            if (count < 2)
+            {
+                Array.Copy(values[newest], output, ChannelCount);
+                return true;
+            }
+
+            // Continue the last segment's trend briefly, then hold
+            int previous = (newest + times.Length - 1) % times.Length;
+            double span = times[newest] - times[previous];
+            double ahead = Math.Min(playout - times[newest], maxExtrapolation);
+            float t = (float)(1.0 + ahead / span);
+            Blend(values[previous], values[newest], t);
+            return true;
+        }
+
+        // Samples are few; walk back from the newest to the bracketing pair
+        int after = newest;
+        for (int i = 1; i < count; i++)
+        {
+            int before = (after + times.Length - 1) % times.Length;
+            if (times[before] <= playout)
+            {
+                float t = (float)((playout - times[before]) / (times[after] - times[before]));
+                Blend(values[before], values[after], t);
+                return true;
+            }
+            after = before;
+        }
+
+        Array.Copy(values[oldest], output, ChannelCount);
+        return true;
+    }
+
+    public float Get(VitalChannel channel)
+    {
+        return output[(int)channel];
+    }
+
+    /// <summary>
+    /// Write the sampled values, rounded where the field is whole, into target
+    /// </summary>
+    public void Fill(VitalSignsData target)
+    {
+        if (target.bloodPressure == null)
+            target.bloodPressure = new BloodPressure();
+
+        target.heartRate = (int)Math.Round(output[(int)VitalChannel.HeartRate]);
+        target.oxygenLevel = (int)Math.Round(output[(int)VitalChannel.OxygenLevel]);
+        target.bloodPressure.systolic = (int)Math.Round(output[(int)VitalChannel.Systolic]);
+        target.bloodPressure.diastolic = (int)Math.Round(output[(int)VitalChannel.Diastolic]);
+        target.respiratoryRate = (int)Math.Round(output[(int)VitalChannel.RespiratoryRate]);
+        target.temperature = output[(int)VitalChannel.Temperature];
+        target.glucose = (int)Math.Round(output[(int)VitalChannel.Glucose]);
+    }
+
+    public void Clear()
+    {
+        count = 0;
+        head = 0;
+        hasOffset = false;
+        lastTimestamp = null;
+        lastPlayout = double.NegativeInfinity;
+    }
+
+    /// <summary>
+    /// Source time plus the smallest transit delay seen so far. The minimum tracks the fastest
+    /// delivery, so a slow response keeps its place on the timeline instead of dragging it;
+    /// larger delays are adopted only gradually, which absorbs clock drift.
+    /// </summary>
+    private double PresentationTime(double arrivalTime, string timestamp)
+    {
+        if (timestamp == null || !DateTimeOffset.TryParse(timestamp, CultureInfo.InvariantCulture,
+                DateTimeStyles.AssumeUniversal, out DateTimeOffset source))
+        {
+            return arrivalTime;
+        }
+
+        double sourceTime = source.ToUnixTimeMilliseconds() / 1000.0;
+        double transit = arrivalTime - sourceTime;
+
+        // A source clock that jumps back (a replay looping, a device reset) starts a new mapping
+        if (!hasOffset || transit < offset || sourceTime <= lastSourceTime)
+        {
+            offset = transit;
+            hasOffset = true;
+        }
+        else
+        {
+            offset += (transit - offset) * OffsetFollowRate;
+        }
+
+        lastSourceTime = sourceTime;
+        return sourceTime + offset;
+    }
+
+    private void Blend(float[] from, float[] to, float t)
+    {
+        for (int c = 0; c < ChannelCount; c++)
+            output[c] = from[c] + (to[c] - from[c]) * t;
+    }
+
+    private int Newest()
+    {
+        return (head + times.Length - 1) % times.Length;
+    }
+
+    private int Oldest()
+    {
+        return count < times.Length ? 0 : head;
+    }
+}
@@ -0,0 +1,271 @@
+using System;
+using System.IO;
+using System.IO.MemoryMappedFiles;
+
+/// <summary>
+/// Recorded vitals and ECG in one file, read through a memory map.
+///
+/// Layout (little-endian):
+///   header  64 bytes: "VREC", version, vitals count, ECG sample count (long), ECG rate, ECG scale,
+///           vitals offset (long), ECG offset (long), start time (Unix seconds, double)
+///   ECG     one short per sample at a fixed rate; value = short * scale
+///   vitals  fixed 32-byte records in time order: time since start (float), then one float per VitalChannel
+///
+/// Every record has a fixed size and position, so opening costs the same for a minute or a day of
+/// data, a seek is a binary search over the mapped records, and only pages actually read are loaded.
+/// </summary>
+public sealed class VitalsRecording : IDisposable
+{
+    public const string Extension = ".vrec";
+
+    internal const int Magic = 0x43455256; // "VREC"
+    internal const int Version = 1;
+    internal const int HeaderSize = 64;
+    internal const int RecordSize = 4 + VitalsTimeSeries.ChannelCount * 4;
+
+    private readonly MemoryMappedFile file;
+    private readonly MemoryMappedViewAccessor view;
+    private readonly long vitalsOffset;
+    private readonly long ecgOffset;
+    private readonly float ecgScale;
+    private short[] ecgScratch = new short[512];
+
+    public int VitalsCount { get; }
+    public long EcgSampleCount { get; }
+    public float EcgSampleRate { get; }
+
+    /// <summary>
+    /// Wall-clock time of the first sample, Unix seconds
+    /// </summary>
+    public double StartTime { get; }
+
+    /// <summary>
+    /// Seconds from the first to the last vitals record, or the ECG's length if longer
+    /// </summary>
+    public double Duration { get; }
+
+    private VitalsRecording(MemoryMappedFile file, MemoryMappedViewAccessor view)
+    {
+        this.file = file;
+        this.view = view;
+
+        VitalsCount = view.ReadInt32(8);
+        EcgSampleCount = view.ReadInt64(16);
+        EcgSampleRate = view.ReadSingle(24);
+        ecgScale = view.ReadSingle(28);
+        vitalsOffset = view.ReadInt64(32);
+        ecgOffset = view.ReadInt64(40);
+        StartTime = view.ReadDouble(48);
+
+        double vitalsDuration = VitalsCount > 0 ? RecordTime(VitalsCount - 1) : 0;
+        double ecgDuration = EcgSampleRate > 0f ? EcgSampleCount / (double)EcgSampleRate : 0;
+        Duration = Math.Max(vitalsDuration, ecgDuration);
+    }
+
+    /// <summary>
+    /// Map a recording; null (with the reason in error) if it is missing or not a valid recording
+    /// </summary>
+    public static VitalsRecording Open(string path, out string error)
+    {
+        error = null;
+        MemoryMappedFile file = null;
+        MemoryMappedViewAccessor view = null;
+
+        try
+        {
+            long length = new FileInfo(path).Length;
+            if (length < HeaderSize)
+            {
+                error = "file too short";
+                return null;
+            }
+
+            file = MemoryMappedFile.CreateFromFile(path, FileMode.Open, null, 0, MemoryMappedFileAccess.Read);
+            view = file.CreateViewAccessor(0, 0, MemoryMappedFileAccess.Read);
+
+            if (view.ReadInt32(0) != Magic || view.ReadInt32(4) != Version)
+                error = "not a version " + Version + " vitals recording";
+            else
+            {
+                int count = view.ReadInt32(8);
+                long samples = view.ReadInt64(16);
+                float rate = view.ReadSingle(24);
+                long vitals = view.ReadInt64(32);
+                long ecg = view.ReadInt64(40);
+                if (count < 0 || samples < 0 || vitals < HeaderSize || ecg < HeaderSize)
+                    error = "bad header";
+                // A recording without ECG is written with rate 0
+                else if (float.IsNaN(rate) || float.IsInfinity(rate) || rate < 0f || (samples > 0 && rate == 0f))
+                    error = "bad ECG sample rate";
+                else if (vitals > length - (long)count * RecordSize || samples > (length - ecg) / 2) // Arranged so huge values can't overflow
+                    error = "truncated";
+            }
+
+            if (error == null)
+                return new VitalsRecording(file, view);
+        }
+        catch (Exception e)
+        {
+            error = e.Message;
+        }
+
+        view?.Dispose();
+        file?.Dispose();
+        return null;
+    }
+
+    public float RecordTime(int index)
+    {
+        return view.ReadSingle(vitalsOffset + (long)index * RecordSize);
+    }
+
+    /// <summary>
+    /// Index of the last vitals record at or before time (seconds since start), or -1 if none
+    /// </summary>
+    public int IndexAt(double time)
+    {
+        int low = 0, high = VitalsCount;
+        while (low < high)
+        {
+            int mid = (low + high) >> 1;
+            if (RecordTime(mid) <= time)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        return low - 1;
+    }
+
+    public float ReadChannel(int index, VitalChannel channel)
+    {
+        return view.ReadSingle(vitalsOffset + (long)index * RecordSize + 4 + (int)channel * 4);
+    }
+
+    public void ReadVitals(int index, VitalSignsData target)
+    {
+        if (target.bloodPressure == null)
+            target.bloodPressure = new BloodPressure();
+
+        target.heartRate = (int)Math.Round(ReadChannel(index, VitalChannel.HeartRate));
+        target.oxygenLevel = (int)Math.Round(ReadChannel(index, VitalChannel.OxygenLevel));
+        target.bloodPressure.systolic = (int)Math.Round(ReadChannel(index, VitalChannel.Systolic));
+        target.bloodPressure.diastolic = (int)Math.Round(ReadChannel(index, VitalChannel.Diastolic));
+        target.respiratoryRate = (int)Math.Round(ReadChannel(index, VitalChannel.RespiratoryRate));
+        target.temperature = ReadChannel(index, VitalChannel.Temperature);
+        target.glucose = (int)Math.Round(ReadChannel(index, VitalChannel.Glucose));
+    }
+
+    /// <summary>
+    /// Copy ECG samples [start, start + count) into destination; returns how many exist
+    /// </summary>
+    public int ReadEcg(long start, float[] destination, int offset, int count)
+    {
+        if (start < 0 || start >= EcgSampleCount)
+            return 0;
+
+        count = (int)Math.Min(count, EcgSampleCount - start);
+        if (ecgScratch.Length < count)
+            ecgScratch = new short[count];
+
+        view.ReadArray(ecgOffset + start * 2, ecgScratch, 0, count);
+        for (int i = 0; i < count; i++)
+            destination[offset + i] = ecgScratch[i] * ecgScale;
+        return count;
+    }
+
+    public void Dispose()
+    {
+        view.Dispose();
+        file.Dispose();
+    }
+}
+
+/// <summary>
+/// Writes a VitalsRecording. ECG streams straight to disk; vitals records (a few bytes a second)
+/// are kept in memory and appended, with the header, when the writer is disposed.
+/// </summary>
+public sealed class VitalsRecordingWriter : IDisposable
+{
+    private readonly FileStream stream;
+    private readonly BinaryWriter writer;
+    private readonly float ecgSampleRate;
+    private readonly float ecgScale;
+    private readonly double startTime;
+    private readonly MemoryStream vitals = new MemoryStream();
+    private readonly BinaryWriter vitalsWriter;
+    private int vitalsCount = 0;
+    private long ecgSamples = 0;
+    private float lastTime = float.NegativeInfinity;
+
+    /// <summary>
+    /// ecgScale is the value of one ECG step; the default covers +/-8 in 1/4096 increments
+    /// </summary>
+    public VitalsRecordingWriter(string path, double startTime, float ecgSampleRate, float ecgScale = 1f / 4096f)
+    {
+        Directory.CreateDirectory(Path.GetDirectoryName(Path.GetFullPath(path)));
+        stream = new FileStream(path, FileMode.Create, FileAccess.Write);
+        writer = new BinaryWriter(stream);
+        vitalsWriter = new BinaryWriter(vitals);
+        this.startTime = startTime;
+        this.ecgSampleRate = ecgSampleRate;
+        this.ecgScale = ecgScale;
+
+        writer.Write(new byte[VitalsRecording.HeaderSize]); // Filled in on Dispose
+    }
+
+    public int VitalsCount => vitalsCount;
+    public long EcgSampleCount => ecgSamples;
+
+    /// <summary>
+    /// Add a vitals record at time seconds since the start; records must be in time order
+    /// </summary>
+    public bool AddVitals(float time, VitalSignsData data)
+    {
+        if (data == null || time <= lastTime)
+            return false;
+
+        lastTime = time;
+        vitalsWriter.Write(time);
+        vitalsWriter.Write((float)data.heartRate);
+        vitalsWriter.Write((float)data.oxygenLevel);
+        vitalsWriter.Write(data.bloodPressure != null ? (float)data.bloodPressure.systolic : 0f);
+        vitalsWriter.Write(data.bloodPressure != null ? (float)data.bloodPressure.diastolic : 0f);
+        vitalsWriter.Write((float)data.respiratoryRate);
+        vitalsWriter.Write(data.temperature);
+        vitalsWriter.Write((float)data.glucose);
+        vitalsCount++;
+        return true;
+    }
+
+    public void AddEcg(float[] samples, int start, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            float steps = samples[start + i] / ecgScale;
+            writer.Write((short)Math.Max(short.MinValue, Math.Min(short.MaxValue, Math.Round(steps))));
+        }
+        ecgSamples += count;
+    }
+
+    public void Dispose()
+    {
+        long vitalsOffset = stream.Position;
+        vitals.Position = 0;
+        vitals.CopyTo(stream);
+
+        stream.Position = 0;
+        writer.Write(VitalsRecording.Magic);
+        writer.Write(VitalsRecording.Version);
+        writer.Write(vitalsCount);
+        writer.Write(0); // Padding
+        writer.Write(ecgSamples);
+        writer.Write(ecgSampleRate);
+        writer.Write(ecgScale);
+        writer.Write(vitalsOffset);
+        writer.Write((long)VitalsRecording.HeaderSize);
+        writer.Write(startTime);
+
+        writer.Dispose();
+        vitalsWriter.Dispose();
+    }
+}
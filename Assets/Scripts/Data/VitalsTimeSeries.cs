@@ -0,0 +1,515 @@
+using System;
+using System.IO;
+using System.IO.MemoryMappedFiles;
+using System.Runtime.InteropServices;
+
+public enum VitalChannel { HeartRate, OxygenLevel, Systolic, Diastolic, RespiratoryRate, Temperature, Glucose }
+
+/// <summary>
+/// One point of a trend query. Raw samples have min == max == mean.
+/// </summary>
+public struct TrendPoint
+{
+    public double time; // Unix seconds (bucket start for rolled-up points)
+    public float min;
+    public float max;
+    public float mean;
+}
+
+/// <summary>
+/// Fixed-size columnar ring store of one patient's vitals.
+/// Tier 0 keeps raw samples; every further tier keeps min/max/mean buckets of a fixed length, fed
+/// directly from the raw samples, so hours of history fit in a few hundred rows.
+/// Each column is a contiguous block, so a trend query reads only the channel it draws.
+/// All state lives in one flat block that is either managed memory or a memory-mapped file, so a
+/// file-backed series picks up where it left off after a scene reload or restart.
+/// </summary>
+public class VitalsTimeSeries : IDisposable
+{
+    public const int ChannelCount = 7;
+
+    private const int Magic = 0x31535456; // "VTS1"
+    private const int HeaderSize = 16;     // magic, channel count, tier count, reserved
+
+    private readonly Storage storage;
+    private readonly Tier[] tiers;
+    private readonly long lastTimeOffset;
+    private double lastTime;
+
+    private class Tier
+    {
+        public int capacity;
+        public int bucketSeconds; // 0 for the raw tier
+        public long stateOffset;  // head, count
+        public long openOffset;   // Bucket being filled: start, count, then min/max/sum per channel
+        public long timeColumn;
+        public long countColumn;
+        public long minColumns;   // Raw tier: the sample values
+        public long maxColumns;
+        public long meanColumns;
+        public int head;          // Next row to write
+        public int count;
+
+        // Open bucket, cached from storage
+        public double openStart;
+        public int openCount;
+        public readonly float[] openMin = new float[ChannelCount];
+        public readonly float[] openMax = new float[ChannelCount];
+        public readonly float[] openSum = new float[ChannelCount];
+    }
+
+    /// <summary>
+    /// rawCapacity raw samples plus, for each entry of bucketSeconds, bucketCapacities[i] buckets.
+    /// With a backingFile the series is stored in (and restored from) that file; if the file's layout
+    /// does not match it is reset.
+    /// </summary>
+    public VitalsTimeSeries(int rawCapacity, int[] bucketSeconds, int[] bucketCapacities, string backingFile = null)
+    {
+        tiers = new Tier[1 + bucketSeconds.Length];
+        long offset = HeaderSize;
+
+        for (int t = 0; t < tiers.Length; t++)
+        {
+            Tier tier = new Tier
+            {
+                capacity = Math.Max(2, t == 0 ? rawCapacity : bucketCapacities[t - 1]),
+                bucketSeconds = t == 0 ? 0 : Math.Max(1, bucketSeconds[t - 1])
+            };
+
+            tier.stateOffset = offset;
+            offset += 8;
+            tier.openOffset = offset;
+            offset += 8 + 4 + ChannelCount * 3 * 4;
+            offset = Align8(offset);
+
+            tier.timeColumn = offset;
+            offset += tier.capacity * 8L;
+            tier.countColumn = offset;
+            offset += tier.capacity * 4L;
+            tier.minColumns = offset;
+            offset += ChannelCount * tier.capacity * 4L;
+
+            if (t > 0)
+            {
+                tier.maxColumns = offset;
+                offset += ChannelCount * tier.capacity * 4L;
+                tier.meanColumns = offset;
+                offset += ChannelCount * tier.capacity * 4L;
+            }
+            offset = Align8(offset);
+            tiers[t] = tier;
+        }
+
+        lastTimeOffset = offset;
+        offset += 8;
+
+        storage = backingFile != null ? MappedStorage.Open(backingFile, offset) : null;
+        if (storage == null)
+            storage = new ArrayStorage(offset);
+
+        if (storage.ReadInt(0) == Magic && storage.ReadInt(4) == ChannelCount && storage.ReadInt(8) == tiers.Length && LayoutMatches())
+            LoadState();
+        else
+            ResetStorage();
+    }
+
+    public bool IsFileBacked => storage is MappedStorage;
+
+    /// <summary>
+    /// Time of the newest sample (Unix seconds), or 0 if empty
+    /// </summary>
+    public double LastTime => lastTime;
+
+    public int RawCount => tiers[0].count;
+
+    /// <summary>
+    /// Append one sample. Samples that are not newer than the last one are ignored.
+    /// </summary>
+    public bool Record(double time, float[] values)
+    {
+        if (time <= lastTime)
+            return false;
+
+        Tier raw = tiers[0];
+        int row = raw.head;
+        storage.WriteDouble(raw.timeColumn + row * 8L, time);
+        for (int c = 0; c < ChannelCount; c++)
+            storage.WriteFloat(ValueOffset(raw.minColumns, raw, c, row), values[c]);
+        Advance(raw);
+
+        for (int t = 1; t < tiers.Length; t++)
+            Accumulate(tiers[t], time, values);
+
+        lastTime = time;
+        storage.WriteDouble(lastTimeOffset, time);
+        return true;
+    }
+
+    public void Record(double time, VitalSignsData vitals, float[] scratch)
+    {
+        scratch[(int)VitalChannel.HeartRate] = vitals.heartRate;
+        scratch[(int)VitalChannel.OxygenLevel] = vitals.oxygenLevel;
+        scratch[(int)VitalChannel.Systolic] = vitals.bloodPressure != null ? vitals.bloodPressure.systolic : 0f;
+        scratch[(int)VitalChannel.Diastolic] = vitals.bloodPressure != null ? vitals.bloodPressure.diastolic : 0f;
+        scratch[(int)VitalChannel.RespiratoryRate] = vitals.respiratoryRate;
+        scratch[(int)VitalChannel.Temperature] = vitals.temperature;
+        scratch[(int)VitalChannel.Glucose] = vitals.glucose;
+        Record(time, scratch);
+    }
+
+    /// <summary>
+    /// Fill output with the channel's trend over [from, to], at most maxPoints points, oldest first.
+    /// Uses the finest tier that both reaches back to from and needs no more than maxPoints points,
+    /// so the cost is O(log n + points returned). Returns the number of points written.
+    /// </summary>
+    public int Query(VitalChannel channel, double from, double to, int maxPoints, TrendPoint[] output)
+    {
+        maxPoints = Math.Min(maxPoints, output.Length);
+        if (maxPoints <= 0 || to < from)
+            return 0;
+
+        Tier tier = SelectTier(from, to, maxPoints);
+        int c = (int)channel;
+        int written = 0;
+
+        int index = LowerBound(tier, tier.bucketSeconds > 0 ? from - tier.bucketSeconds : from);
+        for (; index < tier.count && written < maxPoints; index++)
+        {
+            int row = PhysicalRow(tier, index);
+            double time = storage.ReadDouble(tier.timeColumn + row * 8L);
+            if (time > to)
+                break;
+
+            TrendPoint point;
+            point.time = time;
+            if (tier.bucketSeconds == 0)
+            {
+                float value = storage.ReadFloat(ValueOffset(tier.minColumns, tier, c, row));
+                point.min = point.max = point.mean = value;
+            }
+            else
+            {
+                point.min = storage.ReadFloat(ValueOffset(tier.minColumns, tier, c, row));
+                point.max = storage.ReadFloat(ValueOffset(tier.maxColumns, tier, c, row));
+                point.mean = storage.ReadFloat(ValueOffset(tier.meanColumns, tier, c, row));
+            }
+            output[written++] = point;
+        }
+
+        // The bucket still being filled carries the newest data of a rolled-up tier
+        if (tier.bucketSeconds > 0 && tier.openCount > 0 && written < maxPoints && tier.openStart <= to && tier.openStart + tier.bucketSeconds >= from)
+        {
+            output[written++] = new TrendPoint
+            {
+                time = tier.openStart,
+                min = tier.openMin[c],
+                max = tier.openMax[c],
+                mean = tier.openSum[c] / tier.openCount
+            };
+        }
+
+        return written;
+    }
+
+    public void Clear()
+    {
+        ResetStorage();
+    }
+
+    public void Dispose()
+    {
+        storage.Dispose();
+    }
+
+    // Tiers
+
+    private Tier SelectTier(double from, double to, int maxPoints)
+    {
+        double span = to - from;
+
+        for (int t = 0; t < tiers.Length; t++)
+        {
+            Tier tier = tiers[t];
+            if (tier.count == 0 && tier.openCount == 0)
+                continue;
+
+            double resolution = tier.bucketSeconds > 0 ? tier.bucketSeconds : RawSpacing();
+            bool fits = resolution > 0 && span / resolution <= maxPoints;
+            bool reachesBack = tier.count < tier.capacity || OldestTime(tier) <= from;
+
+            if (fits && reachesBack)
+                return tier;
+        }
+
+        // Nothing fine enough reaches that far back: use the longest history available
+        return tiers[tiers.Length - 1];
+    }
+
+    private double RawSpacing()
+    {
+        Tier raw = tiers[0];
+        if (raw.count < 2)
+            return 1;
+
+        double oldest = OldestTime(raw);
+        return (lastTime - oldest) / (raw.count - 1);
+    }
+
+    private double OldestTime(Tier tier)
+    {
+        return tier.count == 0 ? double.MaxValue : storage.ReadDouble(tier.timeColumn + PhysicalRow(tier, 0) * 8L);
+    }
+
+    private void Accumulate(Tier tier, double time, float[] values)
+    {
+        double bucketStart = Math.Floor(time / tier.bucketSeconds) * tier.bucketSeconds;
+
+        if (tier.openCount > 0 && bucketStart != tier.openStart)
+            CloseBucket(tier);
+
+        if (tier.openCount == 0)
+        {
+            tier.openStart = bucketStart;
+            for (int c = 0; c < ChannelCount; c++)
+            {
+                tier.openMin[c] = values[c];
+                tier.openMax[c] = values[c];
+                tier.openSum[c] = values[c];
+            }
+        }
+        else
+        {
+            for (int c = 0; c < ChannelCount; c++)
+            {
+                tier.openMin[c] = Math.Min(tier.openMin[c], values[c]);
+                tier.openMax[c] = Math.Max(tier.openMax[c], values[c]);
+                tier.openSum[c] += values[c];
+            }
+        }
+
+        tier.openCount++;
+        SaveOpenBucket(tier);
+    }
+
+    private void CloseBucket(Tier tier)
+    {
+        int row = tier.head;
+        storage.WriteDouble(tier.timeColumn + row * 8L, tier.openStart);
+        storage.WriteInt(tier.countColumn + row * 4L, tier.openCount);
+
+        for (int c = 0; c < ChannelCount; c++)
+        {
+            storage.WriteFloat(ValueOffset(tier.minColumns, tier, c, row), tier.openMin[c]);
+            storage.WriteFloat(ValueOffset(tier.maxColumns, tier, c, row), tier.openMax[c]);
+            storage.WriteFloat(ValueOffset(tier.meanColumns, tier, c, row), tier.openSum[c] / tier.openCount);
+        }
+
+        Advance(tier);
+        tier.openCount = 0;
+    }
+
+    private void Advance(Tier tier)
+    {
+        tier.head = (tier.head + 1) % tier.capacity;
+        if (tier.count < tier.capacity)
+            tier.count++;
+
+        storage.WriteInt(tier.stateOffset, tier.head);
+        storage.WriteInt(tier.stateOffset + 4, tier.count);
+    }
+
+    /// <summary>
+    /// First logical index whose time is at or after time (rows are in time order)
+    /// </summary>
+    private int LowerBound(Tier tier, double time)
+    {
+        int low = 0, high = tier.count;
+        while (low < high)
+        {
+            int mid = (low + high) >> 1;
+            if (storage.ReadDouble(tier.timeColumn + PhysicalRow(tier, mid) * 8L) < time)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        return low;
+    }
+
+    private static int PhysicalRow(Tier tier, int index)
+    {
+        // index 0 is the oldest row
+        int oldest = tier.count < tier.capacity ? 0 : tier.head;
+        int row = oldest + index;
+        return row >= tier.capacity ? row - tier.capacity : row;
+    }
+
+    private static long ValueOffset(long columns, Tier tier, int channel, int row)
+    {
+        return columns + ((long)channel * tier.capacity + row) * 4L;
+    }
+
+    // Persistence
+
+    private bool LayoutMatches()
+    {
+        foreach (Tier tier in tiers)
+        {
+            int head = storage.ReadInt(tier.stateOffset);
+            int count = storage.ReadInt(tier.stateOffset + 4);
+            if (head < 0 || head >= tier.capacity || count < 0 || count > tier.capacity)
+                return false;
+        }
+        return storage.ReadInt(12) == LayoutHash();
+    }
+
+    private int LayoutHash()
+    {
+        int hash = 17;
+        foreach (Tier tier in tiers)
+            hash = hash * 31 + tier.capacity * 7 + tier.bucketSeconds;
+        return hash;
+    }
+
+    private void LoadState()
+    {
+        foreach (Tier tier in tiers)
+        {
+            tier.head = storage.ReadInt(tier.stateOffset);
+            tier.count = storage.ReadInt(tier.stateOffset + 4);
+
+            tier.openStart = storage.ReadDouble(tier.openOffset);
+            tier.openCount = storage.ReadInt(tier.openOffset + 8);
+            long values = tier.openOffset + 12;
+            for (int c = 0; c < ChannelCount; c++)
+            {
+                tier.openMin[c] = storage.ReadFloat(values + c * 12L);
+                tier.openMax[c] = storage.ReadFloat(values + c * 12L + 4);
+                tier.openSum[c] = storage.ReadFloat(values + c * 12L + 8);
+            }
+        }
+        lastTime = storage.ReadDouble(lastTimeOffset);
+    }
+
+    private void SaveOpenBucket(Tier tier)
+    {
+        storage.WriteDouble(tier.openOffset, tier.openStart);
+        storage.WriteInt(tier.openOffset + 8, tier.openCount);
+        long values = tier.openOffset + 12;
+        for (int c = 0; c < ChannelCount; c++)
+        {
+            storage.WriteFloat(values + c * 12L, tier.openMin[c]);
+            storage.WriteFloat(values + c * 12L + 4, tier.openMax[c]);
+            storage.WriteFloat(values + c * 12L + 8, tier.openSum[c]);
+        }
+    }
+
+    private void ResetStorage()
+    {
+        foreach (Tier tier in tiers)
+        {
+            tier.head = 0;
+            tier.count = 0;
+            tier.openCount = 0;
+            tier.openStart = 0;
+            storage.WriteInt(tier.stateOffset, 0);
+            storage.WriteInt(tier.stateOffset + 4, 0);
+            SaveOpenBucket(tier);
+        }
+
+        lastTime = 0;
+        storage.WriteDouble(lastTimeOffset, 0);
+        storage.WriteInt(4, ChannelCount);
+        storage.WriteInt(8, tiers.Length);
+        storage.WriteInt(12, LayoutHash());
+        storage.WriteInt(0, Magic); // Last, so a torn reset is never mistaken for a valid file
+    }
+
+    private static long Align8(long offset)
+    {
+        return (offset + 7) & ~7L;
+    }
+
+    // Backing stores
+
+    private abstract class Storage : IDisposable
+    {
+        public abstract int ReadInt(long offset);
+        public abstract float ReadFloat(long offset);
+        public abstract double ReadDouble(long offset);
+        public abstract void WriteInt(long offset, int value);
+        public abstract void WriteFloat(long offset, float value);
+        public abstract void WriteDouble(long offset, double value);
+        public virtual void Dispose() { }
+    }
+
+    private class ArrayStorage : Storage
+    {
+        private readonly byte[] bytes;
+
+        public ArrayStorage(long size)
+        {
+            bytes = new byte[size];
+        }
+
+        public override int ReadInt(long offset) => MemoryMarshal.Read<int>(bytes.AsSpan((int)offset));
+        public override float ReadFloat(long offset) => MemoryMarshal.Read<float>(bytes.AsSpan((int)offset));
+        public override double ReadDouble(long offset) => MemoryMarshal.Read<double>(bytes.AsSpan((int)offset));
+        public override void WriteInt(long offset, int value) => MemoryMarshal.Write(bytes.AsSpan((int)offset), ref value);
+        public override void WriteFloat(long offset, float value) => MemoryMarshal.Write(bytes.AsSpan((int)offset), ref value);
+        public override void WriteDouble(long offset, double value) => MemoryMarshal.Write(bytes.AsSpan((int)offset), ref value);
+    }
+
+    private class MappedStorage : Storage
+    {
+        private readonly MemoryMappedFile file;
+        private readonly MemoryMappedViewAccessor view;
+
+        private MappedStorage(MemoryMappedFile file, MemoryMappedViewAccessor view)
+        {
+            this.file = file;
+            this.view = view;
+        }
+
+        /// <summary>
+        /// Map the file (created or resized to size); null if that is not possible on this platform
+        /// </summary>
+        public static MappedStorage Open(string path, long size)
+        {
+            try
+            {
+                Directory.CreateDirectory(Path.GetDirectoryName(path));
+                using (FileStream stream = new FileStream(path, FileMode.OpenOrCreate, FileAccess.ReadWrite))
+                {
+                    if (stream.Length != size)
+                    {
+                        // A different size is a different layout; start from zeros
+                        stream.SetLength(0);
+                        stream.SetLength(size);
+                    }
+                }
+
+                MemoryMappedFile file = MemoryMappedFile.CreateFromFile(path, FileMode.Open, null, size, MemoryMappedFileAccess.ReadWrite);
+                return new MappedStorage(file, file.CreateViewAccessor(0, size));
+            }
+            catch (Exception e)
+            {
+                UnityEngine.Debug.LogWarning($"Vitals history file {path} unavailable, keeping it in memory: {e.Message}");
+                return null;
+            }
+        }
+
+        public override int ReadInt(long offset) => view.ReadInt32(offset);
+        public override float ReadFloat(long offset) => view.ReadSingle(offset);
+        public override double ReadDouble(long offset) => view.ReadDouble(offset);
+        public override void WriteInt(long offset, int value) => view.Write(offset, value);
+        public override void WriteFloat(long offset, float value) => view.Write(offset, value);
+        public override void WriteDouble(long offset, double value) => view.Write(offset, value);
+
+        public override void Dispose()
+        {
+            view.Flush();
+            view.Dispose();
+            file.Dispose();
+        }
+    }
+}
@@ -0,0 +1,368 @@
+using UnityEngine;
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Net;
+using System.Text;
+using System.Threading;
+using Debug = UnityEngine.Debug;
+
+/// <summary>
+/// Local stand-in for the vitals backend, so latency and bandwidth can be measured offline.
+/// Serves /iotData/{monitorId}/vitals/latest like the real API, plus the batch and stream
+/// endpoints VitalsPollingHub can use, replaying a recording at a configurable rate.
+/// The latest route also implements ETag / If-None-Match and the binary delta format
+/// (VitalsBinaryCodec), so both wire formats can be benchmarked against each other.
+/// Requests are handled on background threads; only Awake and OnDestroy touch Unity objects.
+/// </summary>
+public class MockVitalsServer : MonoBehaviour
+{
+    [Header("Server")]
+    public int port = 8787;
+    public bool pointHubAtServer = true; // Redirect VitalsPollingHub here (set before any subscriber starts)
+
+    [Header("Replay")]
+    public TextAsset recording;                // One VitalSignsData JSON object per line; random-walk vitals if empty
+    public float samplesPerSecond = 1f;        // How fast the recording advances
+    public float streamChecksPerSecond = 10f;  // How often open streams look for changed vitals
+    public float keepAliveSeconds = 15f;       // Comment line sent on idle streams so dead clients are noticed
+
+    private HttpListener listener;
+    private Thread acceptThread;
+    private volatile bool running = false;
+    private VitalSignsData[] frames;
+    private readonly Stopwatch clock = new Stopwatch();
+
+    private long bytesSent = 0;
+    private long binaryBytesSent = 0;
+    private long jsonBytesSent = 0;
+    private int notModifiedSent = 0;
+    private int requestsServed = 0;
+    private int openStreams = 0;
+
+    public string BaseUrl => $"http://localhost:{port}/iotData/";
+    public long BytesSent => Interlocked.Read(ref bytesSent);
+    public long JsonLatestBytesSent => Interlocked.Read(ref jsonBytesSent);
+    public long BinaryLatestBytesSent => Interlocked.Read(ref binaryBytesSent);
+    public int NotModifiedSent => notModifiedSent;
+    public int RequestsServed => requestsServed;
+    public int OpenStreams => openStreams;
+
+    private void Awake()
+    {
+        frames = LoadRecording();
+        clock.Start();
+
+        try
+        {
+            listener = new HttpListener();
+            listener.Prefixes.Add($"http://localhost:{port}/");
+            listener.Start();
+        }
+        catch (Exception e)
+        {
+            Debug.LogError($"Mock vitals server could not listen on port {port}: {e.Message}");
+            listener = null;
+            return;
+        }
+
+        running = true;
+        acceptThread = new Thread(AcceptLoop) { IsBackground = true, Name = "MockVitalsServer" };
+        acceptThread.Start();
+
+        if (pointHubAtServer)
+        {
+            VitalsPollingHub hub = VitalsPollingHub.Instance;
+            hub.baseUrl = BaseUrl;
+            hub.batchUrl = BaseUrl + "vitals/batch";
+            hub.streamUrl = BaseUrl + "vitals/stream";
+        }
+
+        Debug.Log($"Mock vitals server replaying {frames.Length} samples at {BaseUrl}");
+    }
+
+    private void OnDestroy()
+    {
+        running = false;
+
+        if (listener != null)
+        {
+            listener.Close();
+            listener = null;
+        }
+
+        if (acceptThread != null)
+        {
+            acceptThread.Join(500);
+            acceptThread = null;
+        }
+    }
+
+    private VitalSignsData[] LoadRecording()
+    {
+        List<VitalSignsData> loaded = new List<VitalSignsData>();
+
+        if (recording != null)
+        {
+            foreach (string line in recording.text.Split('\n'))
+            {
+                if (string.IsNullOrWhiteSpace(line))
+                    continue;
+
+                try
+                {
+                    VitalSignsData frame = JsonUtility.FromJson<VitalSignsData>(line);
+                    if (frame != null)
+                        loaded.Add(frame);
+                }
+                catch (Exception e)
+                {
+                    Debug.LogWarning($"Skipping malformed recording line: {e.Message}");
+                }
+            }
+        }
+
+        return loaded.Count > 0 ? loaded.ToArray() : SynthesizeRecording(600);
+    }
+
+    private static VitalSignsData[] SynthesizeRecording(int count)
+    {
+        System.Random random = new System.Random(1234);
+        VitalSignsData[] synthesized = new VitalSignsData[count];
+        float heartRate = 75f, oxygen = 97f, respiratory = 14f, temperature = 36.8f;
+        float systolic = 120f, diastolic = 80f;
+
+        for (int i = 0; i < count; i++)
+        {
+            heartRate = Mathf.Clamp(heartRate + (float)(random.NextDouble() - 0.5) * 4f, 55f, 110f);
+            oxygen = Mathf.Clamp(oxygen + (float)(random.NextDouble() - 0.5), 92f, 100f);
+            respiratory = Mathf.Clamp(respiratory + (float)(random.NextDouble() - 0.5), 10f, 22f);
+            temperature = Mathf.Clamp(temperature + (float)(random.NextDouble() - 0.5) * 0.1f, 36f, 38.5f);
+            systolic = Mathf.Clamp(systolic + (float)(random.NextDouble() - 0.5) * 3f, 100f, 150f);
+            diastolic = Mathf.Clamp(diastolic + (float)(random.NextDouble() - 0.5) * 2f, 60f, 95f);
+
+            synthesized[i] = new VitalSignsData
+            {
+                batteryLevel = 100 - i * 50 / count,
+                bedOccupancy = true,
+                bloodPressure = new BloodPressure { systolic = Mathf.RoundToInt(systolic), diastolic = Mathf.RoundToInt(diastolic) },
+                deviceStatus = "active",
+                glucose = 95 + (i / 60) % 10,
+                heartRate = Mathf.RoundToInt(heartRate),
+                oxygenLevel = Mathf.RoundToInt(oxygen),
+                patientId = "mock_patient",
+                respiratoryRate = Mathf.RoundToInt(respiratory),
+                signalStrength = 90,
+                temperature = Mathf.Round(temperature * 10f) / 10f,
+                timestamp = DateTime.UtcNow.AddSeconds(i).ToString("o")
+            };
+        }
+        return synthesized;
+    }
+
+    // Requests
+
+    private void AcceptLoop()
+    {
+        while (running)
+        {
+            HttpListenerContext context;
+            try
+            {
+                context = listener.GetContext();
+            }
+            catch (Exception)
+            {
+                // Listener closed on shutdown
+                break;
+            }
+
+            ThreadPool.QueueUserWorkItem(_ => Handle(context));
+        }
+    }
+
+    private void Handle(HttpListenerContext context)
+    {
+        Interlocked.Increment(ref requestsServed);
+
+        try
+        {
+            string path = context.Request.Url.AbsolutePath.TrimEnd('/');
+            string[] monitors = (context.Request.QueryString["monitors"] ?? "").Split(new[] { ',' }, StringSplitOptions.RemoveEmptyEntries);
+
+            if (path == "/iotData/vitals/stream")
+            {
+                Stream(context, monitors);
+            }
+            else if (path == "/iotData/vitals/batch")
+            {
+                VitalSignsBatchResponse response = new VitalSignsBatchResponse { monitors = new VitalSignsBatchEntry[monitors.Length] };
+                for (int i = 0; i < monitors.Length; i++)
+                    response.monitors[i] = new VitalSignsBatchEntry { monitorId = monitors[i], data = CurrentFrame(monitors[i], out _) };
+
+                WriteJson(context, JsonUtility.ToJson(response));
+            }
+            else if (path.StartsWith("/iotData/") && path.EndsWith("/vitals/latest"))
+            {
+                string monitorId = path.Substring("/iotData/".Length, path.Length - "/iotData/".Length - "/vitals/latest".Length);
+                Latest(context, monitorId);
+            }
+            else
+            {
+                context.Response.StatusCode = 404;
+                context.Response.Close();
+            }
+        }
+        catch (Exception)
+        {
+            // Client went away mid-response
+            context.Response.Abort();
+        }
+    }
+
+    /// <summary>
+    /// Latest vitals with conditional and format negotiation. The replay step is the sample's sequence
+    /// number and ETag; any earlier step can be regenerated, so every delta base is available.
+    /// </summary>
+    private void Latest(HttpListenerContext context, string monitorId)
+    {
+        HttpListenerRequest request = context.Request;
+        uint sequence = CurrentSequence();
+        VitalSignsData frame = FrameAt(monitorId, sequence);
+        string etag = "\"" + sequence + "\"";
+
+        context.Response.Headers["ETag"] = etag;
+        if (request.Headers["If-None-Match"] == etag)
+        {
+            Interlocked.Increment(ref notModifiedSent);
+            context.Response.StatusCode = 304;
+            context.Response.Close();
+            return;
+        }
+
+        string accept = request.Headers["Accept"];
+        if (accept != null && accept.Contains(VitalsBinaryCodec.ContentType))
+        {
+            VitalSignsData baseline = null;
+            uint baseSequence = 0;
+            if (uint.TryParse(request.Headers[VitalsBinaryCodec.BaseHeader], out baseSequence) && baseSequence > 0 && baseSequence < sequence)
+                baseline = FrameAt(monitorId, baseSequence);
+
+            byte[] frameBytes = new byte[VitalsBinaryCodec.MaxFrameSize];
+            int length = VitalsBinaryCodec.Encode(frame, sequence, baseline, baseSequence, frameBytes);
+            WriteBody(context, VitalsBinaryCodec.ContentType, frameBytes, length);
+            Interlocked.Add(ref binaryBytesSent, length);
+            return;
+        }
+
+        VitalSignsResponse response = new VitalSignsResponse { timestamp = frame.timestamp, data = frame, patientId = frame.patientId };
+        int jsonLength = WriteJson(context, JsonUtility.ToJson(response));
+        Interlocked.Add(ref jsonBytesSent, jsonLength);
+    }
+
+    private int WriteJson(HttpListenerContext context, string json)
+    {
+        byte[] body = Encoding.UTF8.GetBytes(json);
+        WriteBody(context, "application/json", body, body.Length);
+        return body.Length;
+    }
+
+    private void WriteBody(HttpListenerContext context, string contentType, byte[] body, int length)
+    {
+        context.Response.ContentType = contentType;
+        context.Response.ContentLength64 = length;
+        context.Response.OutputStream.Write(body, 0, length);
+        context.Response.Close();
+        Interlocked.Add(ref bytesSent, length);
+    }
+
+    /// <summary>
+    /// Server-Sent Events: one event per monitor whenever its replayed sample changes.
+    /// The event id is the send time in Unix ms so clients can measure delivery latency.
+    /// </summary>
+    private void Stream(HttpListenerContext context, string[] monitors)
+    {
+        HttpListenerResponse response = context.Response;
+        response.ContentType = "text/event-stream";
+        response.SendChunked = true;
+        response.Headers["Cache-Control"] = "no-cache";
+
+        Interlocked.Increment(ref openStreams);
+        int[] lastSent = new int[monitors.Length];
+        for (int i = 0; i < lastSent.Length; i++)
+            lastSent[i] = -1;
+
+        long lastWriteMs = clock.ElapsedMilliseconds;
+        int checkIntervalMs = Mathf.Max(1, Mathf.RoundToInt(1000f / streamChecksPerSecond));
+
+        try
+        {
+            while (running)
+            {
+                StringBuilder events = new StringBuilder();
+                for (int i = 0; i < monitors.Length; i++)
+                {
+                    VitalSignsData frame = CurrentFrame(monitors[i], out int index);
+                    if (index == lastSent[i])
+                        continue;
+
+                    lastSent[i] = index;
+                    VitalSignsBatchEntry entry = new VitalSignsBatchEntry { monitorId = monitors[i], data = frame };
+                    events.Append("id: ").Append(DateTimeOffset.UtcNow.ToUnixTimeMilliseconds()).Append('\n');
+                    events.Append("data: ").Append(JsonUtility.ToJson(entry)).Append("\n\n");
+                }
+
+                if (events.Length == 0 && clock.ElapsedMilliseconds - lastWriteMs >= keepAliveSeconds * 1000f)
+                    events.Append(": keep-alive\n\n");
+
+                if (events.Length > 0)
+                {
+                    byte[] chunk = Encoding.UTF8.GetBytes(events.ToString());
+                    response.OutputStream.Write(chunk, 0, chunk.Length);
+                    response.OutputStream.Flush();
+                    Interlocked.Add(ref bytesSent, chunk.Length);
+                    lastWriteMs = clock.ElapsedMilliseconds;
+                }
+
+                Thread.Sleep(checkIntervalMs);
+            }
+        }
+        finally
+        {
+            Interlocked.Decrement(ref openStreams);
+            response.Abort();
+        }
+    }
+
+    /// <summary>
+    /// Replay position for a monitor; each monitor starts at a different point in the recording
+    /// </summary>
+    private VitalSignsData CurrentFrame(string monitorId, out int index)
+    {
+        long step = (long)(clock.Elapsed.TotalSeconds * samplesPerSecond);
+        index = FrameIndex(monitorId, step);
+        return frames[index];
+    }
+
+    /// <summary>
+    /// Sequence numbers start at 1 so 0 can mean "no sample"
+    /// </summary>
+    private uint CurrentSequence()
+    {
+        return (uint)(clock.Elapsed.TotalSeconds * samplesPerSecond) + 1;
+    }
+
+    private VitalSignsData FrameAt(string monitorId, uint sequence)
+    {
+        return frames[FrameIndex(monitorId, sequence - 1)];
+    }
+
+    private int FrameIndex(string monitorId, long step)
+    {
+        int offset = 0;
+        foreach (char c in monitorId)
+            offset = offset * 31 + c;
+
+        return (int)((step + (offset & 0x7fffffff)) % frames.Length);
+    }
+}
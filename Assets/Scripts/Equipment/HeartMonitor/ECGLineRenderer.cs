@@ -1,67 +1,141 @@
 ﻿using UnityEngine;
-using System.Collections.Generic;
 
 public class ECGLineRenderer : MonoBehaviour
 {
     public ECGSignalGenerator generator;
     private LineRenderer lineRenderer;
 
-    public float xSpacing = 0.01f;         // Horizontal spacing between points
-    public int maxSamples = 500;            // Number of samples visible on screen (~2 seconds)
+    public float xSpacing = 0.01f;         // Horizontal spacing between display columns
+    public int maxSamples = 500;            // Number of display columns visible on screen
     public float samplesPerSecond = 250f;  // Sample rate for ECG data
+    public float visibleSeconds = 2f;      // Time span covered by the visible columns
 
-    private Queue<float> dataBuffer = new Queue<float>();
+    [Header("Multi-Lead Source")]
+    public MultiLeadECGSource multiLeadSource; // Optional: draw one lead of a shared patient instead of the generator
+    public MultiLeadECGSystem.Lead lead = MultiLeadECGSystem.Lead.II;
+
+    private WaveformRingBuffer sampleRing;  // Producer: generator (or any worker), consumer: this renderer
+    private WaveformDecimator decimator;    // Samples -> one min/max envelope per column
+    private WaveformWindow visibleColumns;  // Two envelope values per column, newest maxSamples columns
+    private Vector3[] positions;            // Persistent LineRenderer positions
+    private float[] drained;                // Reused read buffer for the ring
     private float timer = 0f;
     private float sampleInterval;
 
+    /// <summary>
+    /// Samples pushed here are drawn on the next frame.
+    /// Lets a worker thread or external source feed the line instead of the generator.
+    /// </summary>
+    public WaveformRingBuffer SampleRing => sampleRing;
+
+    void Awake()
+    {
+        int visibleSamples = Mathf.CeilToInt(samplesPerSecond * visibleSeconds);
+        sampleRing = new WaveformRingBuffer(Mathf.Max(visibleSamples, maxSamples) * 2);
+        decimator = new WaveformDecimator(samplesPerSecond * visibleSeconds / maxSamples);
+        visibleColumns = new WaveformWindow(maxSamples * 2);
+        positions = new Vector3[maxSamples * 2];
+        drained = new float[sampleRing.Capacity];
+    }
+
     void Start()
     {
         lineRenderer = GetComponent<LineRenderer>();
 
-        if (generator == null)
+        if (multiLeadSource != null)
+        {
+            // The shared system sets the rate; the column layout stays the same
+            samplesPerSecond = multiLeadSource.SamplesPerSecond;
+            decimator.SamplesPerColumn = samplesPerSecond * visibleSeconds / maxSamples;
+            multiLeadSource.AddConsumer(lead, sampleRing);
+        }
+        else if (generator == null)
         {
-            Debug.LogError("ECG Generator not assigned.");
-            enabled = false;
-            return;
+            Debug.LogWarning("ECG Generator not assigned. Waiting for samples on SampleRing.");
         }
 
         lineRenderer.widthCurve = AnimationCurve.Constant(0, 1, 0.005f);
         sampleInterval = 1f / samplesPerSecond;
 
         // Initialize buffer with zeros for a clean start
-        for (int i = 0; i < maxSamples; i++)
-            dataBuffer.Enqueue(0f);
+        visibleColumns.Fill(0f);
+        for (int i = 0; i < positions.Length; i++)
+            positions[i] = new Vector3((i >> 1) * xSpacing, 0, 0);
+
+        lineRenderer.positionCount = positions.Length;
+        DrawWave();
+    }
 
-        DrawWave(new List<float>(dataBuffer));
+    void OnDestroy()
+    {
+        if (multiLeadSource != null)
+            multiLeadSource.RemoveConsumer(lead, sampleRing);
     }
 
     void Update()
+    {
+        if (generator != null && multiLeadSource == null)
+            ProduceSamples();
+
+        DecimateSamples();
+        DrawWave();
+    }
+
+    void ProduceSamples()
     {
         timer += Time.deltaTime;
 
-        // Generate as many samples as needed to keep up with real time
-        while (timer >= sampleInterval)
+        // Work out how many samples are due this frame and generate them in one batch
+        int due = (int)(timer / sampleInterval);
+        timer -= due * sampleInterval;
+
+        // After a long hitch only the newest visible span can ever be on screen
+        int visibleSamples = Mathf.CeilToInt(samplesPerSecond * visibleSeconds);
+        if (due > visibleSamples)
         {
-            timer -= sampleInterval;
-            float newSample = generator.GenerateNextSample();
+            generator.SkipSamples(due - visibleSamples);
+            due = visibleSamples;
+        }
 
-            if (dataBuffer.Count >= maxSamples)
-                dataBuffer.Dequeue();
+        // Generate straight into the ring; at most two spans when the write wraps
+        while (due > 0)
+        {
+            int span = sampleRing.GetWriteSpan(out float[] array, out int offset);
+            if (span == 0)
+            {
+                generator.SkipSamples(due);
+                break;
+            }
 
-            dataBuffer.Enqueue(newSample);
+            span = Mathf.Min(span, due);
+            generator.GenerateSamples(array, offset, span);
+            sampleRing.CommitWrite(span);
+            due -= span;
         }
-
-        DrawWave(new List<float>(dataBuffer));
     }
 
-    void DrawWave(List<float> data)
+    void DecimateSamples()
     {
-        lineRenderer.positionCount = data.Count;
-        int i = 0;
-        foreach (var val in data)
+        int count = sampleRing.Read(drained, 0, drained.Length);
+        for (int i = 0; i < count; i++)
         {
-            lineRenderer.SetPosition(i, new Vector3(i * xSpacing, val, 0));
-            i++;
+            int columns = decimator.Push(drained[i], out float first, out float second);
+            for (int c = 0; c < columns; c++)
+            {
+                visibleColumns.Push(first);
+                visibleColumns.Push(second);
+            }
         }
     }
+
+    void DrawWave()
+    {
+        float[] envelope = visibleColumns.Array;
+        int offset = visibleColumns.Offset;
+
+        for (int i = 0; i < positions.Length; i++)
+            positions[i].y = envelope[offset + i];
+
+        lineRenderer.SetPositions(positions);
+    }
 }
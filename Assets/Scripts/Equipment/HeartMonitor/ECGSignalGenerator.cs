@@ -8,42 +8,152 @@ public class ECGSignalGenerator : MonoBehaviour
     public HeartCondition condition = HeartCondition.Normal;
     public int samplesPerSecond = 250;
 
-    private int sampleIndex = 0;  // track current sample index
+    [Header("Heart Rate Sync")]
+    public ConfigurableAPIManager apiManager; // Optional: retune from live vitals
+    public bool syncWithHeartRate = false;
+
     private float bpm;
     private float samplesPerBeat;
+    private float phase = 0f;          // Position within the current beat, [0, 1)
+    private float phaseIncrement;      // Beat phase advanced per sample
+    private float beatScale = 1f;      // Current beat length relative to the nominal one
+    private int tableLevel;
+    private bool liveHeartRate = false;
+
+    // PQRST components in normalized beat time: P, Q, R, S, T
+    private static readonly float[] waveMeans = { 0.1f, 0.25f, 0.3f, 0.35f, 0.6f };
+    private static readonly float[] waveStdDevs = { 0.01f, 0.005f, 0.008f, 0.005f, 0.02f };
+    private static readonly float[] waveAmplitudes = { 0.2f, -0.15f, 1.0f, -0.25f, 0.35f };
+
+    // Beat templates are rendered once per app; every condition with a rhythm shares the PQRST shape
+    private static readonly ECGWavetable pqrstTemplate = ECGWavetable.Build(waveMeans, waveStdDevs, waveAmplitudes);
 
     void Start()
     {
         bpm = GetHeartRate(condition);
         samplesPerBeat = samplesPerSecond / (bpm / 60f);
+        UpdatePhaseIncrement();
+
+        if (apiManager != null)
+        {
+            apiManager.OnVitalSignsUpdated.AddListener(OnVitalSignsUpdated);
+        }
     }
 
-    public float GenerateNextSample()
+    void OnValidate()
     {
-        float value = 0f;
-        switch (condition)
+        // Condition or rate edited in the Inspector during play
+        if (Application.isPlaying && samplesPerBeat > 0f)
+            UpdatePhaseIncrement();
+    }
+
+    void OnDestroy()
+    {
+        if (apiManager != null)
         {
-            case HeartCondition.Normal:
-                value = SimulatePQRST(sampleIndex % (int)samplesPerBeat, samplesPerBeat);
-                break;
-            case HeartCondition.Bradycardia:
-                value = SimulatePQRST(sampleIndex % (int)(samplesPerBeat * 1.5f), samplesPerBeat * 1.5f);
-                break;
-            case HeartCondition.Tachycardia:
-                value = SimulatePQRST(sampleIndex % (int)(samplesPerBeat * 0.6f), samplesPerBeat * 0.6f);
-                break;
-            case HeartCondition.Arrhythmia:
-                float offset = Mathf.Sin(sampleIndex * 0.01f) * Random.Range(0.8f, 1.2f);
-                value = SimulatePQRST(sampleIndex % (int)(samplesPerBeat * offset), samplesPerBeat * offset);
-                break;
-            case HeartCondition.Flatline:
-                value = 0f;
-                break;
+            apiManager.OnVitalSignsUpdated.RemoveListener(OnVitalSignsUpdated);
         }
-        sampleIndex++;
+    }
+
+    private void OnVitalSignsUpdated(VitalSignsData vitalSigns)
+    {
+        if (syncWithHeartRate && vitalSigns != null && vitalSigns.heartRate > 0)
+        {
+            SetHeartRate(vitalSigns.heartRate);
+        }
+    }
+
+    /// <summary>
+    /// Retune the rhythm live. Only the phase increment changes, so the waveform stays continuous.
+    /// </summary>
+    public void SetHeartRate(float newBpm)
+    {
+        if (newBpm <= 0f)
+            return;
+
+        bpm = newBpm;
+        samplesPerBeat = samplesPerSecond / (bpm / 60f);
+        liveHeartRate = true;
+        UpdatePhaseIncrement();
+    }
+
+    public float GenerateNextSample()
+    {
+        if (condition == HeartCondition.Flatline)
+            return 0f;
+
+        float value = pqrstTemplate.Sample(phase, tableLevel);
+        AdvancePhase();
         return value;
     }
 
+    /// <summary>
+    /// Fill buffer[start .. start + count) with the next samples in a single call.
+    /// One interpolated table read per sample, whatever the rate or condition.
+    /// </summary>
+    public void GenerateSamples(float[] buffer, int start, int count)
+    {
+        if (count <= 0)
+            return;
+
+        if (condition == HeartCondition.Flatline)
+        {
+            System.Array.Clear(buffer, start, count);
+            return;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            buffer[start + i] = pqrstTemplate.Sample(phase, tableLevel);
+            AdvancePhase();
+        }
+    }
+
+    /// <summary>
+    /// Advance the generator without producing output (used when a frame falls far behind)
+    /// </summary>
+    public void SkipSamples(int count)
+    {
+        for (int i = 0; i < count; i++)
+            AdvancePhase();
+    }
+
+    private void AdvancePhase()
+    {
+        phase += phaseIncrement;
+        if (phase >= 1f)
+        {
+            phase -= 1f;
+            if (phase >= 1f)
+                phase = 0f;
+            StartBeat();
+        }
+    }
+
+    /// <summary>
+    /// Beat-to-beat variability is decided once per beat, not per sample
+    /// </summary>
+    private void StartBeat()
+    {
+        if (condition == HeartCondition.Arrhythmia)
+        {
+            beatScale = Random.Range(0.8f, 1.2f);
+            UpdatePhaseIncrement();
+        }
+    }
+
+    private void UpdatePhaseIncrement()
+    {
+        // Preset conditions stretch the nominal beat; a live heart rate is used as measured
+        float scale = liveHeartRate ? 1f : GetBeatScale(condition);
+        if (condition == HeartCondition.Arrhythmia)
+            scale *= beatScale;
+
+        float beatLength = samplesPerBeat * scale;
+        phaseIncrement = beatLength > 1f ? 1f / beatLength : 0f;
+        tableLevel = pqrstTemplate.SelectLevel(phaseIncrement);
+    }
+
     float GetHeartRate(HeartCondition condition)
     {
         switch (condition)
@@ -56,19 +166,13 @@ public class ECGSignalGenerator : MonoBehaviour
         }
     }
 
-    float SimulatePQRST(float index, float beatLength)
-    {
-        float t = index / beatLength;
-        return Gaussian(t, 0.1f, 0.01f) * 0.2f +
-               Gaussian(t, 0.25f, 0.005f) * -0.15f +
-               Gaussian(t, 0.3f, 0.008f) * 1.0f +
-               Gaussian(t, 0.35f, 0.005f) * -0.25f +
-               Gaussian(t, 0.6f, 0.02f) * 0.35f;
-    }
-
-    float Gaussian(float t, float mean, float stdDev)
+    float GetBeatScale(HeartCondition condition)
     {
-        float a = (t - mean) / stdDev;
-        return Mathf.Exp(-0.5f * a * a);
+        switch (condition)
+        {
+            case HeartCondition.Bradycardia: return 1.5f;
+            case HeartCondition.Tachycardia: return 0.6f;
+            default: return 1f;
+        }
     }
 }
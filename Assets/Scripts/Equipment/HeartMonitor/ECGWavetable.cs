@@ -0,0 +1,82 @@
+using UnityEngine;
+
+/// <summary>
+/// Pre-rendered single-beat ECG template, sampled over normalized beat phase [0, 1).
+/// Built once from the analytic PQRST Gaussians and stored as a chain of progressively
+/// smaller tables. Each smaller table is low-pass filtered for faster playback, so fast
+/// rates read a band-limited copy instead of skipping over the narrow QRS complex.
+/// </summary>
+public class ECGWavetable
+{
+    private const int LargestTableSize = 2048;
+    private const int SmallestTableSize = 64;
+
+    private readonly float[][] levels; // levels[0] is the largest table; each holds size + 1 entries (wrap guard)
+
+    private ECGWavetable(float[] means, float[] stdDevs, float[] amplitudes)
+    {
+        int levelCount = 0;
+        for (int size = LargestTableSize; size >= SmallestTableSize; size /= 2)
+            levelCount++;
+
+        levels = new float[levelCount][];
+        int tableSize = LargestTableSize;
+
+        for (int level = 0; level < levelCount; level++, tableSize /= 2)
+        {
+            float[] table = new float[tableSize + 1];
+
+            // Gaussian convolved with a Gaussian is still a Gaussian: widen each wave by half a
+            // table entry and scale it to keep its area, which band-limits the table analytically
+            float blur = 0.5f / tableSize;
+
+            for (int w = 0; w < means.Length; w++)
+            {
+                float stdDev = Mathf.Sqrt(stdDevs[w] * stdDevs[w] + blur * blur);
+                float amplitude = amplitudes[w] * stdDevs[w] / stdDev;
+
+                for (int i = 0; i < tableSize; i++)
+                {
+                    float a = ((float)i / tableSize - means[w]) / stdDev;
+                    table[i] += amplitude * Mathf.Exp(-0.5f * a * a);
+                }
+            }
+
+            table[tableSize] = table[0];
+            levels[level] = table;
+        }
+    }
+
+    /// <summary>
+    /// Template for the given wave components (mean, standard deviation, amplitude in beat phase)
+    /// </summary>
+    public static ECGWavetable Build(float[] means, float[] stdDevs, float[] amplitudes)
+    {
+        return new ECGWavetable(means, stdDevs, amplitudes);
+    }
+
+    /// <summary>
+    /// Pick the smallest (most filtered) table that still has at least one entry per output sample
+    /// </summary>
+    public int SelectLevel(float phaseIncrement)
+    {
+        for (int level = levels.Length - 1; level > 0; level--)
+        {
+            if (phaseIncrement * (levels[level].Length - 1) >= 1f)
+                return level;
+        }
+        return 0;
+    }
+
+    /// <summary>
+    /// Linearly interpolated read at phase in [0, 1)
+    /// </summary>
+    public float Sample(float phase, int level)
+    {
+        float[] table = levels[level];
+        float position = phase * (table.Length - 1);
+        int index = (int)position;
+        float fraction = position - index;
+        return table[index] + (table[index + 1] - table[index]) * fraction;
+    }
+}
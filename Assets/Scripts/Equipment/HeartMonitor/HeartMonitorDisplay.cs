@@ -1,48 +1,50 @@
 ﻿using UnityEngine;
 using TMPro;
-using UnityEngine.Networking;
-using System.Collections;
 
 public class HeartMonitorDisplay : MonoBehaviour
 {
     public TextMeshProUGUI displayText;
     public string apiUrl = "https://smarthospitalbackend.onrender.com";
+    public float updateInterval = 1f;
 
-    private Coroutine fetchRoutine;
+    private readonly HeartData data = new HeartData(); // Overwritten by each response
+    private PanelLabel displayLabel;
 
     void Start()
     {
-        fetchRoutine = StartCoroutine(GetHeartData());
+        displayLabel = new PanelLabel(displayText);
+
+        // The hub owns (and disposes) the request and shares it with any other display on this URL
+        VitalsPollingHub.Instance.SubscribeUrl(apiUrl, updateInterval, OnHeartDataReceived, OnHeartDataFailed);
     }
 
     void OnDestroy()
     {
-        if (fetchRoutine != null)
-            StopCoroutine(fetchRoutine);
+        if (VitalsPollingHub.HasInstance)
+            VitalsPollingHub.Instance.UnsubscribeUrl(apiUrl, OnHeartDataReceived);
     }
 
-    IEnumerator GetHeartData()
+    void OnHeartDataReceived(string json)
     {
-        while (true)
+        // Fields missing from the response read as 0, as they did with a fresh object
+        data.heart_rate = 0;
+        data.spo2 = 0;
+        try
+        {
+            JsonUtility.FromJsonOverwrite(json, data);
+        }
+        catch (System.Exception e)
         {
-            UnityWebRequest request = UnityWebRequest.Get(apiUrl);
-            yield return request.SendWebRequest();
-
-            if (request.result == UnityWebRequest.Result.Success)
-            {
-                string json = request.downloadHandler.text;
-                HeartData data = JsonUtility.FromJson<HeartData>(json);
-                if (displayText != null)
-                    displayText.text = $"HR: {data.heart_rate} bpm\nSpO₂: {data.spo2}%";
-            }
-            else
-            {
-                if (displayText != null)
-                    displayText.text = "Error fetching data";
-            }
-
-            yield return new WaitForSeconds(1);
+            Debug.LogError($"Error parsing heart data: {e.Message}");
+            return;
         }
+
+        displayLabel.Begin().Append("HR: ").Append(data.heart_rate).Append(" bpm\nSpO₂: ").Append(data.spo2).Append('%').Commit();
+    }
+
+    void OnHeartDataFailed(string error)
+    {
+        displayLabel.Set("Error fetching data");
     }
 }
 
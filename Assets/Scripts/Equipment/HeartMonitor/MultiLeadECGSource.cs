@@ -0,0 +1,137 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+/// <summary>
+/// One patient's heart in the MultiLeadECGSystem. Put it on the patient (or monitor) object and
+/// point any number of ECG displays at it, each showing one lead.
+/// </summary>
+public class MultiLeadECGSource : MonoBehaviour
+{
+    [Header("Rhythm")]
+    public ECGSignalGenerator.HeartCondition condition = ECGSignalGenerator.HeartCondition.Normal;
+    public float heartRate = 75f;
+
+    [Header("Heart Rate Sync")]
+    public ConfigurableAPIManager apiManager; // Optional: retune from live vitals
+    public bool syncWithHeartRate = true;
+
+    private struct Consumer
+    {
+        public MultiLeadECGSystem.Lead lead;
+        public WaveformRingBuffer ring;
+    }
+
+    private MultiLeadECGSystem system;
+    private readonly List<Consumer> consumers = new List<Consumer>(); // Re-attached whenever the source is re-registered
+
+    /// <summary>
+    /// Slot in the system's patient arrays; -1 while not registered
+    /// </summary>
+    public int Slot { get; internal set; } = -1;
+
+    /// <summary>
+    /// Sample rate of every lead this source produces
+    /// </summary>
+    public int SamplesPerSecond => system != null ? system.samplesPerSecond : MultiLeadECGSystem.Instance.samplesPerSecond;
+
+    void OnEnable()
+    {
+        system = MultiLeadECGSystem.Instance;
+        Slot = system.Register(this);
+        foreach (Consumer consumer in consumers)
+        {
+            system.AddConsumer(Slot, consumer.lead, consumer.ring);
+        }
+
+        if (apiManager != null)
+        {
+            apiManager.OnVitalSignsUpdated.AddListener(OnVitalSignsUpdated);
+        }
+    }
+
+    void OnDisable()
+    {
+        if (apiManager != null)
+        {
+            apiManager.OnVitalSignsUpdated.RemoveListener(OnVitalSignsUpdated);
+        }
+
+        if (system != null)
+        {
+            system.Unregister(this);
+        }
+        Slot = -1;
+    }
+
+    void OnValidate()
+    {
+        // Rate or condition edited in the Inspector during play
+        if (Application.isPlaying && system != null && Slot >= 0)
+        {
+            system.SetCondition(Slot, condition);
+            system.SetHeartRate(Slot, heartRate);
+        }
+    }
+
+    private void OnVitalSignsUpdated(VitalSignsData vitalSigns)
+    {
+        if (syncWithHeartRate && vitalSigns != null && vitalSigns.heartRate > 0)
+        {
+            SetHeartRate(vitalSigns.heartRate);
+        }
+
+        // A simulated patient also knows its rhythm
+        if (syncWithHeartRate && apiManager.IsSimulated)
+        {
+            ECGSignalGenerator.HeartCondition rhythm = PhysiologySimulator.Instance.GetRhythm(apiManager.SimulatorHandle);
+            if (rhythm != condition)
+                SetCondition(rhythm);
+        }
+    }
+
+    public void SetHeartRate(float bpm)
+    {
+        heartRate = bpm;
+        if (system != null)
+            system.SetHeartRate(Slot, bpm);
+    }
+
+    public void SetCondition(ECGSignalGenerator.HeartCondition newCondition)
+    {
+        condition = newCondition;
+        if (system != null)
+            system.SetCondition(Slot, newCondition);
+    }
+
+    /// <summary>
+    /// Stream one lead into ring (same rate as SamplesPerSecond)
+    /// </summary>
+    public void AddConsumer(MultiLeadECGSystem.Lead lead, WaveformRingBuffer ring)
+    {
+        if (ring == null || IndexOfConsumer(lead, ring) >= 0)
+            return;
+
+        consumers.Add(new Consumer { lead = lead, ring = ring });
+        if (system != null && Slot >= 0)
+            system.AddConsumer(Slot, lead, ring);
+    }
+
+    public void RemoveConsumer(MultiLeadECGSystem.Lead lead, WaveformRingBuffer ring)
+    {
+        int index = IndexOfConsumer(lead, ring);
+        if (index >= 0)
+            consumers.RemoveAt(index);
+        if (system != null && Slot >= 0)
+            system.RemoveConsumer(Slot, lead, ring);
+    }
+
+    private int IndexOfConsumer(MultiLeadECGSystem.Lead lead, WaveformRingBuffer ring)
+    {
+        for (int i = 0; i < consumers.Count; i++)
+        {
+            if (consumers[i].lead == lead && consumers[i].ring == ring)
+                return i;
+        }
+        return -1;
+    }
+}
@@ -0,0 +1,323 @@
+using UnityEngine;
+using System.Collections.Generic;
+
+/// <summary>
+/// Generates 12-lead ECG for every registered patient in one structure-of-arrays pass per frame.
+/// Each patient has a single cardiac dipole (a 3D vector driven by the PQRST template); every
+/// lead is the projection of that dipole on the lead's axis, so all leads stay consistent.
+/// Consumers receive samples for one (patient, lead) pair through a WaveformRingBuffer.
+/// </summary>
+[DefaultExecutionOrder(-50)]
+public class MultiLeadECGSystem : MonoBehaviour
+{
+    public enum Lead { I, II, III, aVR, aVL, aVF, V1, V2, V3, V4, V5, V6 }
+    public const int LeadCount = 12;
+
+    [Header("Sampling")]
+    public int samplesPerSecond = 250;
+    public float maxCatchUpSeconds = 0.25f; // Samples beyond this after a hitch are dropped
+
+    private static MultiLeadECGSystem instance;
+
+    // Patient state, structure of arrays indexed by slot
+    private int patientCount = 0;
+    private MultiLeadECGSource[] sources = new MultiLeadECGSource[4];
+    private ECGSignalGenerator.HeartCondition[] conditions = new ECGSignalGenerator.HeartCondition[4];
+    private float[] heartRates = new float[4];
+    private float[] phases = new float[4];
+    private float[] phaseIncrements = new float[4];
+    private float[] beatScales = new float[4];
+    private int[] tableLevels = new int[4];
+    private List<WaveformRingBuffer>[] leadConsumers = new List<WaveformRingBuffer>[4 * LeadCount];
+
+    private float sampleTimer = 0f;
+
+    // Dipole model, shared by all patients: x = patient left, y = inferior, z = anterior
+    private static readonly ECGWavetable dipoleX;
+    private static readonly ECGWavetable dipoleY;
+    private static readonly ECGWavetable dipoleZ;
+    private static readonly Vector3[] leadAxes = BuildLeadAxes();
+
+    static MultiLeadECGSystem()
+    {
+        // Same P, Q, R, S, T timing and widths as ECGSignalGenerator
+        float[] means = { 0.1f, 0.25f, 0.3f, 0.35f, 0.6f };
+        float[] stdDevs = { 0.01f, 0.005f, 0.008f, 0.005f, 0.02f };
+        float[] leadIIAmplitudes = { 0.2f, -0.15f, 1.0f, -0.25f, 0.35f };
+
+        // Mean direction of each wave's dipole: P and R point down-left, the septal Q
+        // right-anterior, the terminal S right-up-posterior, T roughly follows R
+        Vector3[] directions =
+        {
+            new Vector3(0.6f, 0.8f, 0.2f),
+            new Vector3(-0.5f, -0.5f, 0.7f),
+            new Vector3(0.55f, 0.75f, -0.35f),
+            new Vector3(-0.4f, -0.6f, -0.7f),
+            new Vector3(0.6f, 0.6f, 0.5f)
+        };
+
+        // Size each wave so lead II reproduces the single-lead template exactly
+        Vector3 leadII = leadAxes[(int)Lead.II];
+        float[] ax = new float[means.Length];
+        float[] ay = new float[means.Length];
+        float[] az = new float[means.Length];
+        for (int w = 0; w < means.Length; w++)
+        {
+            Vector3 direction = directions[w].normalized;
+            Vector3 dipole = direction * (leadIIAmplitudes[w] / Vector3.Dot(direction, leadII));
+            ax[w] = dipole.x;
+            ay[w] = dipole.y;
+            az[w] = dipole.z;
+        }
+
+        dipoleX = ECGWavetable.Build(means, stdDevs, ax);
+        dipoleY = ECGWavetable.Build(means, stdDevs, ay);
+        dipoleZ = ECGWavetable.Build(means, stdDevs, az);
+    }
+
+    private static Vector3[] BuildLeadAxes()
+    {
+        Vector3[] axes = new Vector3[LeadCount];
+
+        // Limb leads: frontal plane angles (degrees, 0 = patient left, 90 = inferior)
+        axes[(int)Lead.I] = FrontalAxis(0f, 1f);
+        axes[(int)Lead.II] = FrontalAxis(60f, 1f);
+        axes[(int)Lead.III] = FrontalAxis(120f, 1f);
+        axes[(int)Lead.aVR] = FrontalAxis(-150f, 0.866f);
+        axes[(int)Lead.aVL] = FrontalAxis(-30f, 0.866f);
+        axes[(int)Lead.aVF] = FrontalAxis(90f, 0.866f);
+
+        // Precordial leads: horizontal plane angles (0 = patient left, 90 = anterior)
+        axes[(int)Lead.V1] = HorizontalAxis(120f);
+        axes[(int)Lead.V2] = HorizontalAxis(90f);
+        axes[(int)Lead.V3] = HorizontalAxis(75f);
+        axes[(int)Lead.V4] = HorizontalAxis(60f);
+        axes[(int)Lead.V5] = HorizontalAxis(30f);
+        axes[(int)Lead.V6] = HorizontalAxis(0f);
+
+        return axes;
+    }
+
+    private static Vector3 FrontalAxis(float degrees, float gain)
+    {
+        float radians = degrees * Mathf.Deg2Rad;
+        return new Vector3(Mathf.Cos(radians), Mathf.Sin(radians), 0f) * gain;
+    }
+
+    private static Vector3 HorizontalAxis(float degrees)
+    {
+        float radians = degrees * Mathf.Deg2Rad;
+        return new Vector3(Mathf.Cos(radians), 0f, Mathf.Sin(radians));
+    }
+
+    public static MultiLeadECGSystem Instance
+    {
+        get
+        {
+            if (instance == null)
+            {
+                instance = FindObjectOfType<MultiLeadECGSystem>();
+                if (instance == null)
+                {
+                    instance = new GameObject("MultiLeadECGSystem").AddComponent<MultiLeadECGSystem>();
+                }
+            }
+            return instance;
+        }
+    }
+
+    private void Awake()
+    {
+        if (instance == null)
+        {
+            instance = this;
+        }
+        else if (instance != this)
+        {
+            Debug.LogWarning("Multiple MultiLeadECGSystem instances found. Using the first one.");
+        }
+    }
+
+    private void OnDestroy()
+    {
+        if (instance == this)
+        {
+            instance = null;
+        }
+    }
+
+    /// <summary>
+    /// Register a patient; returns its slot
+    /// </summary>
+    public int Register(MultiLeadECGSource source)
+    {
+        if (patientCount == sources.Length)
+            Grow(sources.Length * 2);
+
+        int slot = patientCount++;
+        sources[slot] = source;
+        conditions[slot] = source.condition;
+        heartRates[slot] = source.heartRate;
+        phases[slot] = 0f;
+        beatScales[slot] = 1f;
+        UpdatePhaseIncrement(slot);
+        return slot;
+    }
+
+    /// <summary>
+    /// Remove a patient; the last patient moves into the freed slot
+    /// </summary>
+    public void Unregister(MultiLeadECGSource source)
+    {
+        int slot = source.Slot;
+        if (slot < 0 || slot >= patientCount || sources[slot] != source)
+            return;
+
+        int last = --patientCount;
+        if (slot != last)
+        {
+            sources[slot] = sources[last];
+            conditions[slot] = conditions[last];
+            heartRates[slot] = heartRates[last];
+            phases[slot] = phases[last];
+            phaseIncrements[slot] = phaseIncrements[last];
+            beatScales[slot] = beatScales[last];
+            tableLevels[slot] = tableLevels[last];
+            for (int lead = 0; lead < LeadCount; lead++)
+            {
+                leadConsumers[slot * LeadCount + lead] = leadConsumers[last * LeadCount + lead];
+            }
+            sources[slot].Slot = slot;
+        }
+
+        sources[last] = null;
+        for (int lead = 0; lead < LeadCount; lead++)
+        {
+            leadConsumers[last * LeadCount + lead] = null;
+        }
+    }
+
+    public void SetHeartRate(int slot, float bpm)
+    {
+        if (slot < 0 || slot >= patientCount || bpm <= 0f)
+            return;
+
+        heartRates[slot] = bpm;
+        UpdatePhaseIncrement(slot);
+    }
+
+    public void SetCondition(int slot, ECGSignalGenerator.HeartCondition condition)
+    {
+        if (slot < 0 || slot >= patientCount)
+            return;
+
+        conditions[slot] = condition;
+        beatScales[slot] = 1f;
+        UpdatePhaseIncrement(slot);
+    }
+
+    public void AddConsumer(int slot, Lead lead, WaveformRingBuffer ring)
+    {
+        if (slot < 0 || slot >= patientCount || ring == null)
+            return;
+
+        int index = slot * LeadCount + (int)lead;
+        if (leadConsumers[index] == null)
+            leadConsumers[index] = new List<WaveformRingBuffer>();
+
+        if (!leadConsumers[index].Contains(ring))
+            leadConsumers[index].Add(ring);
+    }
+
+    public void RemoveConsumer(int slot, Lead lead, WaveformRingBuffer ring)
+    {
+        if (slot < 0 || slot >= patientCount)
+            return;
+
+        leadConsumers[slot * LeadCount + (int)lead]?.Remove(ring);
+    }
+
+    private void Update()
+    {
+        sampleTimer += Time.deltaTime;
+        int due = Mathf.FloorToInt(sampleTimer * samplesPerSecond);
+        sampleTimer -= (float)due / samplesPerSecond;
+
+        due = Mathf.Min(due, Mathf.CeilToInt(maxCatchUpSeconds * samplesPerSecond));
+        if (due <= 0)
+            return;
+
+        // One pass over all patients; all of them sample in lockstep on the shared clock
+        for (int p = 0; p < patientCount; p++)
+        {
+            int consumerBase = p * LeadCount;
+            bool flatline = conditions[p] == ECGSignalGenerator.HeartCondition.Flatline;
+
+            for (int s = 0; s < due; s++)
+            {
+                float x = 0f, y = 0f, z = 0f;
+                if (!flatline)
+                {
+                    float phase = phases[p];
+                    int level = tableLevels[p];
+                    x = dipoleX.Sample(phase, level);
+                    y = dipoleY.Sample(phase, level);
+                    z = dipoleZ.Sample(phase, level);
+                    AdvancePhase(p);
+                }
+
+                for (int lead = 0; lead < LeadCount; lead++)
+                {
+                    List<WaveformRingBuffer> rings = leadConsumers[consumerBase + lead];
+                    if (rings == null || rings.Count == 0)
+                        continue;
+
+                    Vector3 axis = leadAxes[lead];
+                    float value = axis.x * x + axis.y * y + axis.z * z;
+                    for (int r = 0; r < rings.Count; r++)
+                    {
+                        rings[r].TryWrite(value);
+                    }
+                }
+            }
+        }
+    }
+
+    private void AdvancePhase(int p)
+    {
+        float phase = phases[p] + phaseIncrements[p];
+        if (phase >= 1f)
+        {
+            phase -= 1f;
+            if (phase >= 1f)
+                phase = 0f;
+
+            // Beat-to-beat variability is decided once per beat
+            if (conditions[p] == ECGSignalGenerator.HeartCondition.Arrhythmia)
+            {
+                beatScales[p] = Random.Range(0.8f, 1.2f);
+                UpdatePhaseIncrement(p);
+            }
+        }
+        phases[p] = phase;
+    }
+
+    private void UpdatePhaseIncrement(int slot)
+    {
+        float beatLength = samplesPerSecond * 60f / heartRates[slot] * beatScales[slot];
+        phaseIncrements[slot] = beatLength > 1f ? 1f / beatLength : 0f;
+        tableLevels[slot] = dipoleX.SelectLevel(phaseIncrements[slot]);
+    }
+
+    private void Grow(int capacity)
+    {
+        System.Array.Resize(ref sources, capacity);
+        System.Array.Resize(ref conditions, capacity);
+        System.Array.Resize(ref heartRates, capacity);
+        System.Array.Resize(ref phases, capacity);
+        System.Array.Resize(ref phaseIncrements, capacity);
+        System.Array.Resize(ref beatScales, capacity);
+        System.Array.Resize(ref tableLevels, capacity);
+        System.Array.Resize(ref leadConsumers, capacity * LeadCount);
+    }
+}
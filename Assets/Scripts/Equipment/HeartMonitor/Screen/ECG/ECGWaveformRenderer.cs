@@ -1,4 +1,3 @@
-using System.Collections.Generic;
 using UnityEngine;
 
 public class ECGWaveformRenderer : MonoBehaviour
@@ -8,10 +7,25 @@ public class ECGWaveformRenderer : MonoBehaviour
     public float xSpacing = 0.005f;     // Space between points (smaller for continuity)
     public float amplitude = 0.3f;
     public float speed = 1f;
+    public bool useExternalSamples = false; // Draw only what producers push into SampleRing
 
-    private Queue<float> ecgValues = new Queue<float>();
+    private WaveformRingBuffer sampleRing;
+    private WaveformWindow ecgValues;   // Newest maxPoints samples, kept contiguous
+    private Vector3[] positions;        // Persistent LineRenderer positions
     private float scrollWidth;
 
+    /// <summary>
+    /// Samples pushed here are drawn on the next frame instead of the built-in fake signal
+    /// </summary>
+    public WaveformRingBuffer SampleRing => sampleRing;
+
+    void Awake()
+    {
+        sampleRing = new WaveformRingBuffer(maxPoints);
+        ecgValues = new WaveformWindow(maxPoints);
+        positions = new Vector3[maxPoints];
+    }
+
     void Start()
     {
         if (!lineRenderer)
@@ -19,8 +33,9 @@ public class ECGWaveformRenderer : MonoBehaviour
 
         scrollWidth = maxPoints * xSpacing;
 
+        ecgValues.Fill(0f);
         for (int i = 0; i < maxPoints; i++)
-            ecgValues.Enqueue(0);
+            positions[i] = new Vector3(i * xSpacing, 0, 0);
 
         // Start centered in container
         transform.localPosition = new Vector3(-scrollWidth * 0.5f, 0, 0.1f);
@@ -28,25 +43,22 @@ public class ECGWaveformRenderer : MonoBehaviour
         // Optional: line appearance
         lineRenderer.widthMultiplier = 0.01f;
         lineRenderer.useWorldSpace = false;
+        lineRenderer.positionCount = maxPoints;
     }
 
     void Update()
     {
-        float value = GenerateFakeECGValue();
+        if (!useExternalSamples)
+            sampleRing.TryWrite(GenerateFakeECGValue());
 
-        ecgValues.Enqueue(value);
-        if (ecgValues.Count > maxPoints)
-            ecgValues.Dequeue();
+        sampleRing.ReadInto(ecgValues);
 
-        lineRenderer.positionCount = ecgValues.Count;
+        float[] values = ecgValues.Array;
+        int head = ecgValues.Offset;
+        for (int i = 0; i < positions.Length; i++)
+            positions[i].y = values[head + i];
 
-        int i = 0;
-        foreach (var v in ecgValues)
-        {
-            float x = i * xSpacing;
-            lineRenderer.SetPosition(i, new Vector3(x, v, 0));
-            i++;
-        }
+        lineRenderer.SetPositions(positions);
 
         // Smooth scroll
         float offset = -Time.time * speed % scrollWidth;
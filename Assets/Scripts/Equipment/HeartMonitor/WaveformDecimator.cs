@@ -0,0 +1,91 @@
+using UnityEngine;
+
+/// <summary>
+/// Reduces a sample stream to one min/max envelope per display column, the way bedside monitors draw.
+/// Display cost then depends on the number of columns, not on the sample rate.
+/// Each column is reported as two values in the order they occurred, so a polyline through
+/// (first, second) of consecutive columns follows the real trace.
+/// </summary>
+public class WaveformDecimator
+{
+    private float samplesPerColumn;
+    private float columnProgress;  // Samples accumulated toward the next column boundary
+    private int samplesInColumn;
+    private float min, max;
+    private int minAt, maxAt;
+
+    public WaveformDecimator(float samplesPerColumn)
+    {
+        SamplesPerColumn = samplesPerColumn;
+    }
+
+    /// <summary>
+    /// May be fractional; values below one repeat the envelope across several columns
+    /// </summary>
+    public float SamplesPerColumn
+    {
+        get => samplesPerColumn;
+        set => samplesPerColumn = Mathf.Max(0.01f, value);
+    }
+
+    /// <summary>
+    /// Add one sample. Returns how many columns it completed (usually 0 or 1); every completed
+    /// column has the envelope given in first/second.
+    /// </summary>
+    public int Push(float sample, out float first, out float second)
+    {
+        if (samplesInColumn == 0)
+        {
+            min = max = sample;
+            minAt = maxAt = 0;
+        }
+        else if (sample < min)
+        {
+            min = sample;
+            minAt = samplesInColumn;
+        }
+        else if (sample > max)
+        {
+            max = sample;
+            maxAt = samplesInColumn;
+        }
+        samplesInColumn++;
+
+        columnProgress += 1f;
+        if (columnProgress < samplesPerColumn)
+        {
+            first = second = sample;
+            return 0;
+        }
+
+        int columns = 0;
+        while (columnProgress >= samplesPerColumn)
+        {
+            columnProgress -= samplesPerColumn;
+            columns++;
+        }
+
+        if (minAt <= maxAt)
+        {
+            first = min;
+            second = max;
+        }
+        else
+        {
+            first = max;
+            second = min;
+        }
+
+        samplesInColumn = 0;
+        return columns;
+    }
+
+    /// <summary>
+    /// Drop the partially accumulated column
+    /// </summary>
+    public void Reset()
+    {
+        columnProgress = 0f;
+        samplesInColumn = 0;
+    }
+}
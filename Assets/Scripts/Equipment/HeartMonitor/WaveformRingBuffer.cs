@@ -0,0 +1,171 @@
+using System.Threading;
+using UnityEngine;
+
+/// <summary>
+/// Fixed-capacity single-producer/single-consumer ring buffer for waveform samples.
+/// The producer (a generator, worker thread or native callback) and the consumer (a renderer)
+/// never lock: each side only advances its own index. Nothing is allocated after construction.
+/// </summary>
+public class WaveformRingBuffer
+{
+    private readonly float[] samples;
+    private readonly int mask;
+
+    private long writeIndex; // Advanced only by the producer
+    private long readIndex;  // Advanced only by the consumer
+
+    public WaveformRingBuffer(int minCapacity)
+    {
+        int capacity = Mathf.NextPowerOfTwo(Mathf.Max(2, minCapacity));
+        samples = new float[capacity];
+        mask = capacity - 1;
+    }
+
+    public int Capacity => samples.Length;
+
+    /// <summary>
+    /// Samples written but not yet read
+    /// </summary>
+    public int Count => (int)(Volatile.Read(ref writeIndex) - Volatile.Read(ref readIndex));
+
+    // Producer side
+
+    /// <summary>
+    /// Append one sample; returns false (and drops it) if the buffer is full
+    /// </summary>
+    public bool TryWrite(float sample)
+    {
+        long write = writeIndex;
+        if (write - Volatile.Read(ref readIndex) >= samples.Length)
+            return false;
+
+        samples[(int)write & mask] = sample;
+        Volatile.Write(ref writeIndex, write + 1);
+        return true;
+    }
+
+    /// <summary>
+    /// Append up to count samples from source; returns how many fitted
+    /// </summary>
+    public int Write(float[] source, int start, int count)
+    {
+        int written = 0;
+        while (written < count)
+        {
+            int span = GetWriteSpan(out float[] array, out int offset);
+            if (span == 0)
+                break;
+
+            span = Mathf.Min(span, count - written);
+            System.Array.Copy(source, start + written, array, offset, span);
+            CommitWrite(span);
+            written += span;
+        }
+        return written;
+    }
+
+    /// <summary>
+    /// Expose the largest contiguous free region so a producer can fill it in place.
+    /// Call CommitWrite with the number of samples actually written.
+    /// </summary>
+    public int GetWriteSpan(out float[] array, out int offset)
+    {
+        long write = writeIndex;
+        int free = samples.Length - (int)(write - Volatile.Read(ref readIndex));
+
+        array = samples;
+        offset = (int)write & mask;
+        return Mathf.Min(free, samples.Length - offset);
+    }
+
+    public void CommitWrite(int count)
+    {
+        Volatile.Write(ref writeIndex, writeIndex + count);
+    }
+
+    // Consumer side
+
+    /// <summary>
+    /// Move up to count samples into destination; returns how many were read
+    /// </summary>
+    public int Read(float[] destination, int start, int count)
+    {
+        long read = readIndex;
+        int available = (int)(Volatile.Read(ref writeIndex) - read);
+        count = Mathf.Min(count, available);
+
+        int offset = (int)read & mask;
+        int firstPart = Mathf.Min(count, samples.Length - offset);
+        System.Array.Copy(samples, offset, destination, start, firstPart);
+        System.Array.Copy(samples, 0, destination, start + firstPart, count - firstPart);
+
+        Volatile.Write(ref readIndex, read + count);
+        return count;
+    }
+
+    /// <summary>
+    /// Drain every pending sample into a display window; returns how many were moved
+    /// </summary>
+    public int ReadInto(WaveformWindow window)
+    {
+        long read = readIndex;
+        int available = (int)(Volatile.Read(ref writeIndex) - read);
+
+        for (int i = 0; i < available; i++)
+        {
+            window.Push(samples[(int)(read + i) & mask]);
+        }
+
+        Volatile.Write(ref readIndex, read + available);
+        return available;
+    }
+
+    /// <summary>
+    /// Discard everything pending (consumer side)
+    /// </summary>
+    public void Clear()
+    {
+        Volatile.Write(ref readIndex, Volatile.Read(ref writeIndex));
+    }
+}
+
+/// <summary>
+/// Consumer-side view of the newest N samples, oldest first.
+/// Every sample is stored twice so the window is always one contiguous run of the backing array.
+/// </summary>
+public class WaveformWindow
+{
+    private readonly float[] mirrored;
+    private readonly int length;
+    private int head;
+
+    public WaveformWindow(int length)
+    {
+        this.length = Mathf.Max(1, length);
+        mirrored = new float[this.length * 2];
+    }
+
+    public int Length => length;
+
+    /// <summary>
+    /// Backing array and start offset of the contiguous window
+    /// </summary>
+    public float[] Array => mirrored;
+    public int Offset => head;
+
+    public float this[int index] => mirrored[head + index];
+
+    public void Push(float sample)
+    {
+        mirrored[head] = sample;
+        mirrored[head + length] = sample;
+        head = head + 1 == length ? 0 : head + 1;
+    }
+
+    public void Fill(float value)
+    {
+        for (int i = 0; i < mirrored.Length; i++)
+            mirrored[i] = value;
+        head = 0;
+    }
+}
@@ -1,6 +1,4 @@
 using UnityEngine;
-using UnityEngine.Networking;
-using System.Collections;
 using System;
 
 public class APIManager : MonoBehaviour
@@ -16,48 +14,24 @@ public class APIManager : MonoBehaviour
     
     private void Start()
     {
-        StartCoroutine(FetchVitalSignsRoutine());
+        // Polled by the shared hub; same URL as a ConfigurableAPIManager means one request for both
+        VitalsPollingHub.Instance.SubscribeVitalsUrl(apiUrl, updateInterval, HandleVitalSigns);
     }
     
-    private IEnumerator FetchVitalSignsRoutine()
+    private void OnDestroy()
     {
-        while (true)
+        if (VitalsPollingHub.HasInstance)
         {
-            yield return FetchVitalSigns();
-            yield return new WaitForSeconds(updateInterval);
+            VitalsPollingHub.Instance.UnsubscribeVitalsUrl(apiUrl, HandleVitalSigns);
         }
     }
     
-    private IEnumerator FetchVitalSigns()
+    private void HandleVitalSigns(VitalSignsData vitalSigns)
     {
-        using (UnityWebRequest request = UnityWebRequest.Get(apiUrl))
-        {
-            request.SetRequestHeader("accept", "application/json");
-            
-            yield return request.SendWebRequest();
-            
-            if (request.result == UnityWebRequest.Result.Success)
-            {
-                try
-                {
-                    string jsonResponse = request.downloadHandler.text;
-                    VitalSignsResponse response = JsonUtility.FromJson<VitalSignsResponse>(jsonResponse);
-                    
-                    currentVitalSigns = response.data;
-                    OnVitalSignsUpdated?.Invoke(currentVitalSigns);
-                    
-                    Debug.Log("Vital signs updated successfully");
-                }
-                catch (Exception e)
-                {
-                    Debug.LogError($"Error parsing API response: {e.Message}");
-                }
-            }
-            else
-            {
-                Debug.LogError($"API request failed: {request.error}");
-            }
-        }
+        currentVitalSigns = vitalSigns;
+        OnVitalSignsUpdated?.Invoke(currentVitalSigns);
+        
+        Debug.Log("Vital signs updated successfully");
     }
     
     public VitalSignsData GetCurrentVitalSigns()
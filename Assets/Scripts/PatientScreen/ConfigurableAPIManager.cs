@@ -1,67 +1,145 @@
 // ConfigurableAPIManager.cs - Handles API communication for any monitor
 using UnityEngine;
-using UnityEngine.Networking;
-using System.Collections;
-using System;
 
 public class ConfigurableAPIManager : MonoBehaviour
 {
     [Header("API Configuration")]
     public string monitorId = "monitor_1"; // Change this for different monitors
     public float updateInterval = 5f; // Update every 5 seconds
+    public bool recordHistory = true; // Keep this monitor's vitals in the VitalsHistoryStore for trend graphs
+    public bool evaluateAlarms = true; // Feed this monitor's vitals to the VitalsAlarmSystem
+    
+    [Header("Simulation")]
+    public bool useSimulator = false; // Generate vitals locally with the PhysiologySimulator instead of polling the backend
+    public PhysiologyProfile simulatedPatient = new PhysiologyProfile();
+    public VitalsReplaySource replaySource; // Optional: play a recorded scenario instead; takes priority over the simulator
+    
+    [Header("Playout")]
+    public float playoutDelay = -1f; // Displays lag updates by this much so they can interpolate; below 0 follows the measured update interval
+    public float playoutMargin = 0.25f; // Added to the measured interval to cover jitter when playoutDelay follows it
+    public float maxExtrapolation = 2f; // How long a trend is continued when the next update is late
     
     [Header("Events")]
     public UnityEngine.Events.UnityEvent<VitalSignsData> OnVitalSignsUpdated;
     
-    private string baseUrl = "https://smarthospitalbackend.onrender.com/iotData/";
     private VitalSignsData currentVitalSigns;
+    private string subscribedMonitorId;
+    private VitalsPlayoutBuffer playout;
+    private int simulatorHandle = -1;
+    private VitalsReplaySource subscribedReplay;
+    private double lastArrival = -1.0;
+    private double arrivalInterval = 0.0; // Smoothed seconds between updates
+    
+    // Handle of this monitor's patient in the PhysiologySimulator, for procedure events; -1 when not simulated
+    public int SimulatorHandle => simulatorHandle;
+    public bool IsSimulated => simulatorHandle >= 0;
+    
+    // Smoothed vitals for per-frame displays; Sample it with Time.unscaledTimeAsDouble
+    public VitalsPlayoutBuffer Playout
+    {
+        get
+        {
+            if (playout == null)
+            {
+                playout = new VitalsPlayoutBuffer(playoutDelay >= 0f ? playoutDelay : updateInterval + playoutMargin, maxExtrapolation);
+            }
+            return playout;
+        }
+    }
     
     private void Start()
     {
-        StartCoroutine(FetchVitalSignsRoutine());
+        Subscribe();
+    }
+    
+    private void OnDestroy()
+    {
+        Unsubscribe();
+        ReleaseAlarms(monitorId);
+    }
+    
+    // Drop a monitor's latched alarms once nothing here feeds it any more
+    private void ReleaseAlarms(string oldMonitorId)
+    {
+        if (VitalsAlarmSystem.HasInstance)
+        {
+            VitalsAlarmSystem.Instance.Unregister(oldMonitorId);
+        }
     }
     
-    private IEnumerator FetchVitalSignsRoutine()
+    // Requests are made by the shared hub, so monitors showing the same ID share one poll
+    private void Subscribe()
     {
-        while (true)
+        subscribedMonitorId = monitorId;
+        if (replaySource != null)
         {
-            yield return FetchVitalSigns();
-            yield return new WaitForSeconds(updateInterval);
+            subscribedReplay = replaySource;
+            subscribedReplay.OnVitalSignsUpdated.AddListener(HandleVitalSigns);
+            return;
         }
+        if (useSimulator)
+        {
+            simulatorHandle = PhysiologySimulator.Instance.Register(simulatedPatient, updateInterval, HandleVitalSigns);
+            return;
+        }
+        VitalsPollingHub.Instance.SubscribeVitals(monitorId, updateInterval, HandleVitalSigns);
     }
     
-    private IEnumerator FetchVitalSigns()
+    private void Unsubscribe()
     {
-        string fullUrl = baseUrl + monitorId + "/vitals/latest";
+        if (subscribedReplay != null)
+        {
+            subscribedReplay.OnVitalSignsUpdated.RemoveListener(HandleVitalSigns);
+            subscribedReplay = null;
+            subscribedMonitorId = null;
+            return;
+        }
         
-        using (UnityWebRequest request = UnityWebRequest.Get(fullUrl))
+        if (simulatorHandle >= 0)
         {
-            request.SetRequestHeader("accept", "application/json");
-            
-            yield return request.SendWebRequest();
-            
-            if (request.result == UnityWebRequest.Result.Success)
+            if (PhysiologySimulator.HasInstance)
             {
-                try
-                {
-                    string jsonResponse = request.downloadHandler.text;
-                    VitalSignsResponse response = JsonUtility.FromJson<VitalSignsResponse>(jsonResponse);
-                    
-                    currentVitalSigns = response.data;
-                    OnVitalSignsUpdated?.Invoke(currentVitalSigns);
-                    
-                    Debug.Log($"Vital signs updated for {monitorId}");
-                }
-                catch (Exception e)
-                {
-                    Debug.LogError($"Error parsing API response for {monitorId}: {e.Message}");
-                }
+                PhysiologySimulator.Instance.Unregister(simulatorHandle);
             }
-            else
+            simulatorHandle = -1;
+            subscribedMonitorId = null;
+            return;
+        }
+        
+        if (subscribedMonitorId != null && VitalsPollingHub.HasInstance)
+        {
+            VitalsPollingHub.Instance.UnsubscribeVitals(subscribedMonitorId, HandleVitalSigns);
+        }
+        subscribedMonitorId = null;
+    }
+    
+    private void HandleVitalSigns(VitalSignsData vitalSigns)
+    {
+        currentVitalSigns = vitalSigns;
+        double now = Time.unscaledTimeAsDouble;
+        if (playoutDelay < 0f)
+        {
+            // Just over one update interval: enough to always have the next sample, no more latency than that
+            if (lastArrival >= 0.0 && now > lastArrival)
             {
-                Debug.LogError($"API request failed for {monitorId}: {request.error}");
+                double interval = now - lastArrival;
+                arrivalInterval = arrivalInterval > 0.0 ? arrivalInterval + (interval - arrivalInterval) * 0.2 : interval;
+                Playout.delay = arrivalInterval + playoutMargin;
             }
+            lastArrival = now;
         }
+        Playout.Push(now, vitalSigns);
+        if (recordHistory)
+        {
+            VitalsHistoryStore.Instance.Record(monitorId, vitalSigns);
+        }
+        if (evaluateAlarms)
+        {
+            VitalsAlarmSystem.Instance.Submit(monitorId, vitalSigns);
+        }
+        OnVitalSignsUpdated?.Invoke(currentVitalSigns);
+        
+        Debug.Log($"Vital signs updated for {monitorId}");
     }
     
     public VitalSignsData GetCurrentVitalSigns()
@@ -69,10 +147,39 @@ public class ConfigurableAPIManager : MonoBehaviour
         return currentVitalSigns;
     }
     
+    // Change how often this monitor wants fresh vitals; the hub polls at the fastest rate asked for
+    public void SetUpdateInterval(float newInterval)
+    {
+        updateInterval = newInterval;
+        if (subscribedReplay != null)
+        {
+            return; // A recording plays at its own rate
+        }
+        if (simulatorHandle >= 0)
+        {
+            PhysiologySimulator.Instance.SetPublishInterval(simulatorHandle, updateInterval);
+        }
+        else if (subscribedMonitorId != null)
+        {
+            VitalsPollingHub.Instance.SubscribeVitals(subscribedMonitorId, updateInterval, HandleVitalSigns);
+        }
+    }
+    
     // Method to change monitor ID at runtime
     public void SetMonitorId(string newMonitorId)
     {
+        if (newMonitorId != monitorId)
+        {
+            ReleaseAlarms(monitorId);
+        }
         monitorId = newMonitorId;
+        playout?.Clear(); // Never interpolate from one patient's vitals into another's
+        lastArrival = -1.0;
+        if (subscribedMonitorId != null)
+        {
+            Unsubscribe();
+            Subscribe();
+        }
         Debug.Log($"Monitor ID changed to: {monitorId}");
     }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 using UnityEngine;
 using UnityEngine.UI;
+using Unity.Collections;
 
 public class LocalECGWaveGenerator : MonoBehaviour
 {
@@ -13,20 +14,36 @@ public class LocalECGWaveGenerator : MonoBehaviour
     public Color waveColor = Color.green;
     public Color backgroundColor = Color.black;
     public int lineThickness = 3;
+    public int eraseGapColumns = 8; // Blank columns kept ahead of the sweep, like a bedside monitor
     
     [Header("Wave Parameters")]
     public float waveSpeed = 2f;
     public float amplitude = 0.3f;
     public float baselineY = 0.5f;
+    public float samplesPerSecond = 250f;   // Signal sample rate, independent of frame rate
+    public float columnsPerSecond = 72f;    // Sweep speed in texture columns
+    public float patternSampleRate = 72f;   // Rate the ecgPattern entries were authored at
     
     [Header("Heart Rate Sync")]
     public bool syncWithHeartRate = true;
+    public bool smoothHeartRate = true; // Follow the API manager's interpolated playout rather than stepping on each update
     public float defaultBPM = 75f;
     
+    [Header("Multi-Lead Source")]
+    public MultiLeadECGSource multiLeadSource; // Optional: sweep one lead of a shared patient instead of ecgPattern
+    public MultiLeadECGSystem.Lead lead = MultiLeadECGSystem.Lead.II;
+    public VitalsReplaySource replaySource; // Optional: sweep a recorded scenario's ECG; takes priority over the lead
+    
     private Texture2D ecgTexture;
-    private float[] waveData;
+    private Color32[] background;         // Background + grid, composed once
+    private WaveformDecimator decimator;  // Samples -> one min/max envelope per column
+    private float[] columnFirst;          // Per column envelope, in the order the values occurred
+    private float[] columnSecond;
     private int currentPosition = 0;
+    private int renderedPosition = 0;     // Last column written into the texture
     private float currentBPM;
+    private WaveformRingBuffer leadRing;  // Filled by the MultiLeadECGSystem or replay when a source is assigned
+    private float[] leadSamples;
     
     // ECG wave pattern (same as before)
     private readonly float[] ecgPattern = new float[]
@@ -44,12 +61,38 @@ public class LocalECGWaveGenerator : MonoBehaviour
         0f, 0f, 0f, 0f, 0f, 0f, 0f, 0f, 0f, 0f
     };
     
-    private int patternIndex = 0;
+    private float patternPosition = 0f; // Fractional index into ecgPattern
     private float timeSinceLastBeat = 0f;
+    private float sampleTimer = 0f;
     
     private void Start()
     {
+        if (replaySource != null && replaySource.EcgSampleRate > 0f)
+        {
+            samplesPerSecond = replaySource.EcgSampleRate;
+            leadRing = new WaveformRingBuffer(Mathf.CeilToInt(samplesPerSecond));
+            leadSamples = new float[leadRing.Capacity];
+        }
+        else if (multiLeadSource != null)
+        {
+            samplesPerSecond = multiLeadSource.SamplesPerSecond;
+            leadRing = new WaveformRingBuffer(Mathf.CeilToInt(samplesPerSecond));
+            leadSamples = new float[leadRing.Capacity];
+        }
+        
         InitializeECGDisplay();
+        
+        if (leadRing != null)
+        {
+            if (replaySource != null && replaySource.EcgSampleRate > 0f)
+            {
+                replaySource.AddEcgConsumer(leadRing);
+            }
+            else
+            {
+                multiLeadSource.AddConsumer(lead, leadRing);
+            }
+        }
         currentBPM = defaultBPM;
         
         // Connect to the specific API manager
@@ -61,16 +104,30 @@ public class LocalECGWaveGenerator : MonoBehaviour
     
     private void OnDestroy()
     {
+        if (replaySource != null && leadRing != null)
+        {
+            replaySource.RemoveEcgConsumer(leadRing);
+        }
+        if (multiLeadSource != null && leadRing != null)
+        {
+            multiLeadSource.RemoveConsumer(lead, leadRing);
+        }
+        
         // Clean up the listener
         if (apiManager != null)
         {
             apiManager.OnVitalSignsUpdated.RemoveListener(OnVitalSignsUpdated);
         }
+        
+        if (ecgTexture != null)
+        {
+            Destroy(ecgTexture);
+        }
     }
     
     private void OnVitalSignsUpdated(VitalSignsData vitalSigns)
     {
-        if (syncWithHeartRate && vitalSigns != null)
+        if (syncWithHeartRate && !smoothHeartRate && vitalSigns != null)
         {
             currentBPM = vitalSigns.heartRate;
         }
@@ -78,12 +135,15 @@ public class LocalECGWaveGenerator : MonoBehaviour
     
     private void InitializeECGDisplay()
     {
-        ecgTexture = new Texture2D(textureWidth, textureHeight);
-        waveData = new float[textureWidth];
+        ecgTexture = new Texture2D(textureWidth, textureHeight, TextureFormat.RGBA32, false);
+        columnFirst = new float[textureWidth];
+        columnSecond = new float[textureWidth];
+        decimator = new WaveformDecimator(samplesPerSecond / columnsPerSecond);
         
         for (int i = 0; i < textureWidth; i++)
         {
-            waveData[i] = baselineY;
+            columnFirst[i] = baselineY;
+            columnSecond[i] = baselineY;
         }
         
         if (ecgDisplay != null)
@@ -91,35 +151,93 @@ public class LocalECGWaveGenerator : MonoBehaviour
             ecgDisplay.texture = ecgTexture;
         }
         
+        ComposeBackground();
         ClearTexture();
     }
     
     private void Update()
     {
+        if (syncWithHeartRate && smoothHeartRate && apiManager != null && apiManager.Playout.Sample(Time.unscaledTimeAsDouble))
+        {
+            float bpm = apiManager.Playout.Get(VitalChannel.HeartRate);
+            if (bpm > 0f)
+            {
+                currentBPM = bpm;
+            }
+        }
+        
         GenerateECGWave();
         UpdateTexture();
     }
     
+    /// <summary>
+    /// Generate every sample due this frame at samplesPerSecond and fold them into
+    /// per-column envelopes, so sample rate and frame rate no longer set the trace density
+    /// </summary>
     private void GenerateECGWave()
     {
-        float beatInterval = 60f / currentBPM;
-        timeSinceLastBeat += Time.deltaTime;
+        if (leadRing != null)
+        {
+            DrainLeadSamples();
+            return;
+        }
+        
+        sampleTimer += Time.deltaTime;
+        int due = Mathf.FloorToInt(sampleTimer * samplesPerSecond);
+        sampleTimer -= due / samplesPerSecond;
         
-        currentPosition = (currentPosition + 1) % textureWidth;
+        // After a long hitch the sweep only needs (just under) one screen worth of samples
+        int screenSamples = Mathf.FloorToInt((textureWidth - 1) * decimator.SamplesPerColumn);
+        due = Mathf.Min(due, screenSamples);
+        
+        for (int i = 0; i < due; i++)
+        {
+            PushSample(NextSample());
+        }
+    }
+    
+    /// <summary>
+    /// The shared system already generated this frame's samples; scale them into the display range
+    /// </summary>
+    private void DrainLeadSamples()
+    {
+        int count = leadRing.Read(leadSamples, 0, leadSamples.Length);
+        for (int i = 0; i < count; i++)
+        {
+            PushSample(Mathf.Clamp(baselineY + leadSamples[i] * amplitude, 0.1f, 0.9f));
+        }
+    }
+    
+    private void PushSample(float sample)
+    {
+        int columns = decimator.Push(sample, out float first, out float second);
+        for (int c = 0; c < columns; c++)
+        {
+            currentPosition = (currentPosition + 1) % textureWidth;
+            columnFirst[currentPosition] = first;
+            columnSecond[currentPosition] = second;
+        }
+    }
+    
+    private float NextSample()
+    {
+        float beatInterval = 60f / currentBPM;
+        timeSinceLastBeat += 1f / samplesPerSecond;
         
         float waveValue = baselineY;
         
         if (timeSinceLastBeat >= beatInterval)
         {
             timeSinceLastBeat = 0f;
-            patternIndex = 0;
+            patternPosition = 0f;
         }
         
-        if (patternIndex < ecgPattern.Length)
+        if (patternPosition < ecgPattern.Length - 1)
         {
-            float patternValue = ecgPattern[patternIndex] * amplitude;
+            int index = (int)patternPosition;
+            float patternValue = Mathf.Lerp(ecgPattern[index], ecgPattern[index + 1], patternPosition - index) * amplitude;
             waveValue = baselineY + patternValue;
-            patternIndex++;
+            patternPosition += patternSampleRate / samplesPerSecond;
             waveValue += Random.Range(-0.01f, 0.01f);
         }
         else
@@ -127,38 +245,75 @@ public class LocalECGWaveGenerator : MonoBehaviour
             waveValue = baselineY + Random.Range(-0.005f, 0.005f);
         }
         
-        waveValue = Mathf.Clamp(waveValue, 0.1f, 0.9f);
-        waveData[currentPosition] = waveValue;
+        return Mathf.Clamp(waveValue, 0.1f, 0.9f);
     }
     
+    /// <summary>
+    /// Sweep-style update: only the columns advanced since the last frame are rewritten
+    /// (background restored, trace drawn) plus the erase gap just ahead of the sweep.
+    /// Cost scales with new samples, not with texture area.
+    /// </summary>
     private void UpdateTexture()
     {
-        ClearTexture();
+        if (renderedPosition == currentPosition)
+            return;
+        
+        Color32 traceColor = waveColor;
         
-        for (int x = 0; x < textureWidth; x++)
+        // The raw data view is only valid until the texture is next uploaded or changed, so fetch it per write
+        NativeArray<Color32> pixels = ecgTexture.GetRawTextureData<Color32>();
+        while (renderedPosition != currentPosition)
         {
-            int dataIndex = (currentPosition + x) % textureWidth;
-            float waveHeight = waveData[dataIndex];
-            int pixelY = Mathf.RoundToInt(waveHeight * (textureHeight - 1));
-            
-            int halfThickness = lineThickness / 2;
-            for (int thickness = -halfThickness; thickness <= halfThickness; thickness++)
-            {
-                int y = pixelY + thickness;
-                if (y >= 0 && y < textureHeight)
-                {
-                    ecgTexture.SetPixel(x, y, waveColor);
-                }
-            }
-            
-            if (lineThickness % 2 == 0)
-            {
-                int y = pixelY + halfThickness + 1;
-                if (y >= 0 && y < textureHeight)
-                {
-                    ecgTexture.SetPixel(x, y, waveColor);
-                }
-            }
+            renderedPosition = (renderedPosition + 1) % textureWidth;
+            RestoreColumn(pixels, renderedPosition);
+            DrawTraceColumn(pixels, renderedPosition, traceColor);
+            RestoreColumn(pixels, (renderedPosition + eraseGapColumns) % textureWidth);
+        }
+        
+        ecgTexture.Apply(false);
+    }
+    
+    private void DrawTraceColumn(NativeArray<Color32> pixels, int x, Color32 traceColor)
+    {
+        float low = Mathf.Min(columnFirst[x], columnSecond[x]);
+        float high = Mathf.Max(columnFirst[x], columnSecond[x]);
+        
+        // Join to where the previous column ended so steep edges stay connected
+        float join = columnSecond[(x + textureWidth - 1) % textureWidth];
+        low = Mathf.Min(low, join);
+        high = Mathf.Max(high, join);
+        
+        int lowY = Mathf.RoundToInt(low * (textureHeight - 1));
+        int highY = Mathf.RoundToInt(high * (textureHeight - 1));
+        
+        int halfThickness = lineThickness / 2;
+        int top = highY + halfThickness + (lineThickness % 2 == 0 ? 1 : 0);
+        int from = Mathf.Max(0, lowY - halfThickness);
+        int to = Mathf.Min(textureHeight - 1, top);
+        
+        for (int y = from; y <= to; y++)
+        {
+            pixels[y * textureWidth + x] = traceColor;
+        }
+    }
+    
+    private void RestoreColumn(NativeArray<Color32> pixels, int x)
+    {
+        for (int index = x; index < background.Length; index += textureWidth)
+        {
+            pixels[index] = background[index];
+        }
+    }
+    
+    private void ComposeBackground()
+    {
+        background = new Color32[textureWidth * textureHeight];
+        Color32 fill = backgroundColor;
+        Color32 grid = Color.gray * 0.2f;
+        
+        for (int i = 0; i < background.Length; i++)
+        {
+            background[i] = fill;
         }
         
         // Grid lines
@@ -166,7 +321,7 @@ public class LocalECGWaveGenerator : MonoBehaviour
         {
             for (int y = 0; y < textureHeight; y += 2)
             {
-                ecgTexture.SetPixel(x, y, Color.gray * 0.2f);
+                background[y * textureWidth + x] = grid;
             }
         }
         
@@ -174,21 +329,16 @@ public class LocalECGWaveGenerator : MonoBehaviour
         {
             for (int x = 0; x < textureWidth; x += 2)
             {
-                ecgTexture.SetPixel(x, y, Color.gray * 0.2f);
+                background[y * textureWidth + x] = grid;
             }
         }
-        
-        ecgTexture.Apply();
     }
     
     private void ClearTexture()
     {
-        Color[] pixels = new Color[textureWidth * textureHeight];
-        for (int i = 0; i < pixels.Length; i++)
-        {
-            pixels[i] = backgroundColor;
-        }
-        ecgTexture.SetPixels(pixels);
+        ecgTexture.GetRawTextureData<Color32>().CopyFrom(background);
+        renderedPosition = currentPosition;
+        ecgTexture.Apply(false);
     }
     
     public void SetBPM(float bpm)
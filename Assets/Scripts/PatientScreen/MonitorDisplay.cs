@@ -23,6 +23,7 @@ public class LocalMonitorDisplay : MonoBehaviour
     public string tempSuffix = "°C";
     public string bpPrefix = "BP: ";
     public string bpSuffix = " mmHg";
+    public bool smoothValues = true; // Show the API manager's interpolated playout instead of jumping on each update
     
     [Header("Time Display Settings")]
     public bool showCurrentTime = true;
@@ -30,8 +31,23 @@ public class LocalMonitorDisplay : MonoBehaviour
     public string dateFormat = "MM/dd/yy";
     public bool showDate = false;
     
+    private readonly VitalSignsData smoothedVitals = new VitalSignsData { bloodPressure = new BloodPressure() };
+    
+    // Labels only rebuild when their text changes, and build it without allocating
+    private PanelLabel hrLabel;
+    private PanelLabel oxygenLabel;
+    private PanelLabel tempLabel;
+    private PanelLabel bpLabel;
+    private PanelLabel timeLabel;
+    
     private void Start()
     {
+        hrLabel = new PanelLabel(hrText);
+        oxygenLabel = new PanelLabel(oxygenText);
+        tempLabel = new PanelLabel(tempText);
+        bpLabel = new PanelLabel(bpText);
+        timeLabel = new PanelLabel(timeText);
+
         // Connect to the specific API manager
         if (apiManager != null)
         {
@@ -51,7 +67,13 @@ public class LocalMonitorDisplay : MonoBehaviour
     
     private void Update()
     {
-        // Update time every frame
+        if (smoothValues && apiManager != null && apiManager.Playout.Sample(Time.unscaledTimeAsDouble))
+        {
+            apiManager.Playout.Fill(smoothedVitals);
+            ShowVitals(smoothedVitals);
+        }
+        
+        // Checked every frame, but only reformatted when the second changes
         if (showCurrentTime && timeText != null)
         {
             UpdateTimeDisplay();
@@ -69,40 +91,30 @@ public class LocalMonitorDisplay : MonoBehaviour
     
     private void UpdateDisplay(VitalSignsData vitalSigns)
     {
-        if (vitalSigns == null) return;
-        
-        // Update Heart Rate
-        if (hrText != null)
-            hrText.text = hrPrefix + vitalSigns.heartRate.ToString() + hrSuffix;
-        
-        // Update Oxygen Level
-        if (oxygenText != null)
-            oxygenText.text = oxygenPrefix + vitalSigns.oxygenLevel.ToString() + oxygenSuffix;
-        
-        // Update Temperature
-        if (tempText != null)
-            tempText.text = tempPrefix + vitalSigns.temperature.ToString("F1") + tempSuffix;
+        // With smoothing on, Update shows the playout instead
+        if (vitalSigns == null || smoothValues) return;
         
-        // Update Blood Pressure
-        if (bpText != null)
-            bpText.text = bpPrefix + vitalSigns.bloodPressure.systolic.ToString() + "/" + 
-                         vitalSigns.bloodPressure.diastolic.ToString() + bpSuffix;
+        ShowVitals(vitalSigns);
     }
     
-    private void UpdateTimeDisplay()
+    private void ShowVitals(VitalSignsData vitalSigns)
     {
-        if (timeText == null) return;
-        
-        DateTime currentTime = DateTime.Now;
-        string displayText = "";
+        // Interpolated values change every frame but their displayed form rarely does
+        hrLabel.Set(hrPrefix, vitalSigns.heartRate, hrSuffix);
+        oxygenLabel.Set(oxygenPrefix, vitalSigns.oxygenLevel, oxygenSuffix);
+        tempLabel.Set(tempPrefix, vitalSigns.temperature, 1, tempSuffix);
         
-        if (showDate)
+        if (vitalSigns.bloodPressure != null)
         {
-            displayText = currentTime.ToString(dateFormat) + "\n";
+            bpLabel.Begin().Append(bpPrefix).Append(vitalSigns.bloodPressure.systolic).Append('/')
+                .Append(vitalSigns.bloodPressure.diastolic).Append(bpSuffix).Commit();
         }
+    }
+    
+    private void UpdateTimeDisplay()
+    {
+        if (timeText == null) return;
         
-        displayText += currentTime.ToString(timeFormat);
-        
-        timeText.text = displayText;
+        timeLabel.SetTime(DateTime.Now, timeFormat, showDate ? dateFormat : null);
     }
 }
\ No newline at end of file
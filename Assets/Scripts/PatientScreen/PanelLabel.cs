@@ -0,0 +1,172 @@
+// PanelLabel.cs - Change-detecting, allocation-free text for monitor and patient panels
+using UnityEngine;
+using TMPro;
+using System;
+
+/// <summary>
+/// Wraps a TMP label and builds its text in a reusable char buffer:
+///   label.Begin().Append("HR: ").Append(hr).Append(" bpm").Commit();
+/// Numbers are formatted straight into the buffer, and Commit only hands the characters to TMP
+/// (which then rebuilds its mesh) when they differ from what the label already shows.
+/// Steady-state updates therefore allocate nothing, and unchanged values cost a short compare.
+/// </summary>
+public class PanelLabel
+{
+    private static readonly string[] FixedFormats = { "F0", "F1", "F2", "F3", "F4" };
+
+    private readonly TMP_Text label;
+    private char[] building = new char[64];
+    private char[] shown = new char[64];
+    private int buildingLength = 0;
+    private int shownLength = -1; // Nothing committed yet
+    private long shownSecond = -1;
+
+    public PanelLabel(TMP_Text label)
+    {
+        this.label = label;
+    }
+
+    public TMP_Text Label => label;
+
+    public PanelLabel Begin()
+    {
+        buildingLength = 0;
+        return this;
+    }
+
+    public PanelLabel Append(string value)
+    {
+        if (value == null)
+            return this;
+
+        Reserve(value.Length);
+        value.CopyTo(0, building, buildingLength, value.Length);
+        buildingLength += value.Length;
+        return this;
+    }
+
+    public PanelLabel AppendUpper(string value)
+    {
+        if (value == null)
+            return this;
+
+        Reserve(value.Length);
+        for (int i = 0; i < value.Length; i++)
+            building[buildingLength++] = char.ToUpperInvariant(value[i]);
+        return this;
+    }
+
+    public PanelLabel Append(char value)
+    {
+        Reserve(1);
+        building[buildingLength++] = value;
+        return this;
+    }
+
+    public PanelLabel Append(int value)
+    {
+        int written;
+        while (!value.TryFormat(building.AsSpan(buildingLength), out written))
+            Reserve(building.Length);
+        buildingLength += written;
+        return this;
+    }
+
+    public PanelLabel Append(float value, int decimals)
+    {
+        string format = FixedFormats[Mathf.Clamp(decimals, 0, FixedFormats.Length - 1)];
+        int written;
+        while (!value.TryFormat(building.AsSpan(buildingLength), out written, format))
+            Reserve(building.Length);
+        buildingLength += written;
+        return this;
+    }
+
+    public PanelLabel Append(DateTime value, string format)
+    {
+        if (string.IsNullOrEmpty(format))
+            return this;
+
+        int written;
+        while (!value.TryFormat(building.AsSpan(buildingLength), out written, format))
+            Reserve(building.Length);
+        buildingLength += written;
+        return this;
+    }
+
+    /// <summary>
+    /// Show the built text if it differs from the current text. Returns true if the label changed.
+    /// </summary>
+    public bool Commit()
+    {
+        if (label == null)
+            return false;
+
+        if (buildingLength == shownLength && building.AsSpan(0, buildingLength).SequenceEqual(shown.AsSpan(0, shownLength)))
+            return false;
+
+        // Keep the committed text to compare against; the buffers swap so neither is copied
+        char[] committed = building;
+        building = shown;
+        shown = committed;
+        shownLength = buildingLength;
+
+        label.SetCharArray(shown, 0, shownLength);
+        return true;
+    }
+
+    /// <summary>
+    /// Clock display: formats and commits only when the wall-clock second changes
+    /// </summary>
+    public void SetTime(DateTime now, string timeFormat, string dateFormat = null)
+    {
+        long second = now.Ticks / TimeSpan.TicksPerSecond;
+        if (second == shownSecond)
+            return;
+        shownSecond = second;
+
+        Begin();
+        if (!string.IsNullOrEmpty(dateFormat))
+        {
+            Append(now, dateFormat).Append('\n');
+        }
+        Append(now, timeFormat).Commit();
+    }
+
+    // Common one-liners
+
+    public bool Set(string value)
+    {
+        return Begin().Append(value).Commit();
+    }
+
+    public bool Set(string prefix, int value, string suffix)
+    {
+        return Begin().Append(prefix).Append(value).Append(suffix).Commit();
+    }
+
+    public bool Set(string prefix, float value, int decimals, string suffix)
+    {
+        return Begin().Append(prefix).Append(value, decimals).Append(suffix).Commit();
+    }
+
+    /// <summary>
+    /// Forget what is shown, so the next Commit always writes (e.g. after something else set the text)
+    /// </summary>
+    public void Invalidate()
+    {
+        shownLength = -1;
+        shownSecond = -1;
+    }
+
+    private void Reserve(int extra)
+    {
+        if (buildingLength + extra <= building.Length)
+            return;
+
+        int size = building.Length;
+        while (size < buildingLength + extra)
+            size *= 2;
+        Array.Resize(ref building, size);
+    }
+}
@@ -1,34 +1,39 @@
 using UnityEngine;
 using TMPro;
+using System.Collections.Generic;
 
 public class PatientCurrentStatusPanel : MonoBehaviour
 {
     public Transform contentHolder;     // The vertical layout group
     public GameObject rowPrefab;        // Assign the row prefab in Inspector
 
+    // Rows are instantiated once and reused; redisplaying only touches labels whose text changed
+    private class Row
+    {
+        public GameObject gameObject;
+        public PanelLabel label;
+        public PanelLabel value;
+    }
+
+    private readonly List<Row> rows = new List<Row>();
+    private int rowsUsed = 0;
+
     public void AddRow(string label, string value)
     {
-        Debug.Log($"Adding Row: {label} = {value}");
+        Row row = NextRow();
+        if (row == null) return;
 
-        if (rowPrefab == null || contentHolder == null)
-        {
-            Debug.LogError("RowPrefab or ContentHolder not assigned!");
-            return;
-        }
+        row.label.Set(label);
+        row.value.Set(value);
+    }
 
-        GameObject row = Instantiate(rowPrefab, contentHolder);
-        TextMeshProUGUI[] texts = row.GetComponentsInChildren<TextMeshProUGUI>();
-        Debug.Log($"Row prefab instantiated with {texts.Length} Text components");
+    public void AddRow(string label, int value)
+    {
+        Row row = NextRow();
+        if (row == null) return;
 
-        if (texts.Length >= 2)
-        {
-            texts[0].text = label;
-            texts[1].text = value;
-        }
-        else
-        {
-            Debug.LogError("Row prefab doesn't have two TextMeshProUGUI children!");
-        }
+        row.label.Set(label);
+        row.value.Set(null, value, null);
     }
 
 
@@ -36,24 +41,69 @@ public class PatientCurrentStatusPanel : MonoBehaviour
     {
         Debug.Log("DisplayPatient() called");
 
-        ClearPanel();
+        rowsUsed = 0;
 
-        Debug.Log("Adding rows...");
         AddRow("Name", data.name);
-        AddRow("Age", data.age.ToString());
+        AddRow("Age", data.age);
         AddRow("Diagnosis", data.currentStatus?.diagnosis ?? "null");
         AddRow("Status", data.currentStatus?.status ?? "null");
         AddRow("Mobility", data.currentStatus?.mobility ?? "null");
         AddRow("Consciousness", data.currentStatus?.consciousness ?? "null");
         // Add more rows as per need:
+
+        HideUnusedRows();
     }
 
 
     public void ClearPanel()
     {
-        foreach (Transform child in contentHolder)
+        rowsUsed = 0;
+        HideUnusedRows();
+    }
+
+    private Row NextRow()
+    {
+        if (rowsUsed < rows.Count)
+        {
+            Row reused = rows[rowsUsed++];
+            if (!reused.gameObject.activeSelf)
+                reused.gameObject.SetActive(true);
+            return reused;
+        }
+
+        if (rowPrefab == null || contentHolder == null)
+        {
+            Debug.LogError("RowPrefab or ContentHolder not assigned!");
+            return null;
+        }
+
+        GameObject instance = Instantiate(rowPrefab, contentHolder);
+        TextMeshProUGUI[] texts = instance.GetComponentsInChildren<TextMeshProUGUI>();
+
+        if (texts.Length < 2)
+        {
+            Debug.LogError("Row prefab doesn't have two TextMeshProUGUI children!");
+            Destroy(instance);
+            return null;
+        }
+
+        Row row = new Row
+        {
+            gameObject = instance,
+            label = new PanelLabel(texts[0]),
+            value = new PanelLabel(texts[1])
+        };
+        rows.Add(row);
+        rowsUsed++;
+        return row;
+    }
+
+    private void HideUnusedRows()
+    {
+        for (int i = rowsUsed; i < rows.Count; i++)
         {
-            Destroy(child.gameObject);
+            if (rows[i].gameObject.activeSelf)
+                rows[i].gameObject.SetActive(false);
         }
     }
 }
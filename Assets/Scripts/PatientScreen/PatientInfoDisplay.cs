@@ -2,7 +2,6 @@
 using UnityEngine;
 using TMPro;
 using System;
-using System.Linq;
 
 public class PatientInfoDisplay : MonoBehaviour
 {
@@ -24,8 +23,27 @@ public class PatientInfoDisplay : MonoBehaviour
     public Color mediumRiskColor = Color.yellow;
     public Color highRiskColor = Color.red;
     
+    private PanelLabel patientNameLabel;
+    private PanelLabel patientDetailsLabel;
+    private PanelLabel diagnosisLabel;
+    private PanelLabel statusLabel;
+    private PanelLabel riskLevelLabel;
+    private PanelLabel allergiesLabel;
+    private PanelLabel medicationsLabel;
+    private PanelLabel recommendationsLabel;
+    
     private void Start()
     {
+        // Text is built in reusable buffers and only handed to TMP when it changed
+        patientNameLabel = new PanelLabel(patientNameText);
+        patientDetailsLabel = new PanelLabel(patientDetailsText);
+        diagnosisLabel = new PanelLabel(diagnosisText);
+        statusLabel = new PanelLabel(statusText);
+        riskLevelLabel = new PanelLabel(riskLevelText);
+        allergiesLabel = new PanelLabel(allergiesText);
+        medicationsLabel = new PanelLabel(medicationsText);
+        recommendationsLabel = new PanelLabel(recommendationsText);
+        
         if (patientAPIManager != null)
         {
             patientAPIManager.OnPatientInfoUpdated.AddListener(UpdatePatientDisplay);
@@ -51,94 +69,102 @@ public class PatientInfoDisplay : MonoBehaviour
         // Update Patient Name
         if (patientNameText != null && patientInfo.personalInfo != null)
         {
-            patientNameText.text = patientInfo.personalInfo.name;
+            patientNameLabel.Set(patientInfo.personalInfo.name);
         }
         
         // Update Patient Details
         if (patientDetailsText != null && patientInfo.personalInfo != null)
         {
-            patientDetailsText.text = $"Age: {patientInfo.personalInfo.age} | {patientInfo.personalInfo.gender}\n" +
-                                    $"Room: {patientInfo.personalInfo.roomId} | Ward: {patientInfo.personalInfo.ward}\n" +
-                                    $"Bed: {patientInfo.personalInfo.bedId}";
+            PersonalInfo info = patientInfo.personalInfo;
+            patientDetailsLabel.Begin()
+                .Append("Age: ").Append(info.age).Append(" | ").Append(info.gender).Append('\n')
+                .Append("Room: ").Append(info.roomId).Append(" | Ward: ").Append(info.ward).Append('\n')
+                .Append("Bed: ").Append(info.bedId)
+                .Commit();
         }
         
         // Update Diagnosis
         if (diagnosisText != null && patientInfo.currentStatus != null)
         {
-            diagnosisText.text = $"Diagnosis: {patientInfo.currentStatus.diagnosis}";
+            diagnosisLabel.Begin().Append("Diagnosis: ").Append(patientInfo.currentStatus.diagnosis).Commit();
         }
         
         // Update Status
         if (statusText != null && patientInfo.currentStatus != null)
         {
-            statusText.text = $"Status: {patientInfo.currentStatus.status.ToUpper()}\n" +
-                            $"Consciousness: {patientInfo.currentStatus.consciousness}\n" +
-                            $"Mobility: {patientInfo.currentStatus.mobility}";
+            statusLabel.Begin()
+                .Append("Status: ").AppendUpper(patientInfo.currentStatus.status).Append('\n')
+                .Append("Consciousness: ").Append(patientInfo.currentStatus.consciousness).Append('\n')
+                .Append("Mobility: ").Append(patientInfo.currentStatus.mobility)
+                .Commit();
         }
         
         // Update Risk Level with color coding
         if (riskLevelText != null && patientInfo.predictions != null)
         {
-            riskLevelText.text = $"Risk Level: {patientInfo.predictions.riskLevel}\n" +
-                               $"Risk Score: {patientInfo.predictions.riskScore}%";
+            riskLevelLabel.Begin()
+                .Append("Risk Level: ").Append(patientInfo.predictions.riskLevel).Append('\n')
+                .Append("Risk Score: ").Append(patientInfo.predictions.riskScore).Append('%')
+                .Commit();
             
             // Color code based on risk level
-            switch (patientInfo.predictions.riskLevel.ToLower())
-            {
-                case "low":
-                    riskLevelText.color = lowRiskColor;
-                    break;
-                case "medium":
-                    riskLevelText.color = mediumRiskColor;
-                    break;
-                case "high":
-                    riskLevelText.color = highRiskColor;
-                    break;
-                default:
-                    riskLevelText.color = Color.white;
-                    break;
-            }
+            string riskLevel = patientInfo.predictions.riskLevel;
+            if (string.Equals(riskLevel, "low", StringComparison.OrdinalIgnoreCase))
+                riskLevelText.color = lowRiskColor;
+            else if (string.Equals(riskLevel, "medium", StringComparison.OrdinalIgnoreCase))
+                riskLevelText.color = mediumRiskColor;
+            else if (string.Equals(riskLevel, "high", StringComparison.OrdinalIgnoreCase))
+                riskLevelText.color = highRiskColor;
+            else
+                riskLevelText.color = Color.white;
         }
         
         // Update Allergies
         if (allergiesText != null && patientInfo.medicalHistory != null && patientInfo.medicalHistory.allergies != null)
         {
-            string allergiesStr = "Allergies: ";
-            if (patientInfo.medicalHistory.allergies.Count > 0)
+            var allergies = patientInfo.medicalHistory.allergies;
+            allergiesLabel.Begin().Append("Allergies: ");
+            if (allergies.Count > 0)
             {
-                allergiesStr += string.Join(", ", patientInfo.medicalHistory.allergies);
+                for (int i = 0; i < allergies.Count; i++)
+                {
+                    if (i > 0) allergiesLabel.Append(", ");
+                    allergiesLabel.Append(allergies[i]);
+                }
             }
             else
             {
-                allergiesStr += "None";
+                allergiesLabel.Append("None");
             }
-            allergiesText.text = allergiesStr;
+            allergiesLabel.Commit();
         }
         
         // Update Medications
         if (medicationsText != null && patientInfo.medicalHistory != null && patientInfo.medicalHistory.medications != null)
         {
-            string medicationsStr = "Current Medications:\n";
-            foreach (var med in patientInfo.medicalHistory.medications.Take(3)) // Show first 3 medications
+            var medications = patientInfo.medicalHistory.medications;
+            medicationsLabel.Begin().Append("Current Medications:\n");
+            for (int i = 0; i < medications.Count && i < 3; i++) // Show first 3 medications
             {
-                medicationsStr += $"• {med.name} {med.dosage} - {med.frequency}\n";
+                var med = medications[i];
+                medicationsLabel.Append("• ").Append(med.name).Append(' ').Append(med.dosage).Append(" - ").Append(med.frequency).Append('\n');
             }
-            if (patientInfo.medicalHistory.medications.Count > 3)
+            if (medications.Count > 3)
             {
-                medicationsStr += $"... and {patientInfo.medicalHistory.medications.Count - 3} more";
+                medicationsLabel.Append("... and ").Append(medications.Count - 3).Append(" more");
             }
-            medicationsText.text = medicationsStr;
+            medicationsLabel.Commit();
         }
         
         // Update Recommendations
         if (recommendationsText != null && patientInfo.predictions != null && patientInfo.predictions.recommendations != null)
         {
-            string recommendationsStr = "Recommendations:\n";
+            recommendationsLabel.Begin().Append("Recommendations:\n");
             foreach (var rec in patientInfo.predictions.recommendations)
             {
-                recommendationsStr += $"• {rec}\n";
+                recommendationsLabel.Append("• ").Append(rec).Append('\n');
             }
-            recommendationsText.text = recommendationsStr;
+            recommendationsLabel.Commit();
         }
     }
 }
\ No newline at end of file
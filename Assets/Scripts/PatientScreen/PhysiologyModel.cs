@@ -0,0 +1,311 @@
+// PhysiologyModel.cs - Fixed-step cardiovascular / respiratory model for many patients at once
+using System;
+
+public enum PhysiologyDrug
+{
+    Epinephrine,    // mg; raises heart rate, contractility and vascular tone
+    Morphine,       // mg; slows heart rate and breathing
+    Phenylephrine,  // mg; raises vascular tone only
+    Dextrose        // g; raises blood glucose
+}
+
+/// <summary>
+/// Baseline of one simulated patient
+/// </summary>
+[Serializable]
+public class PhysiologyProfile
+{
+    public string patientId = "sim_patient";
+    public float heartRate = 75f;
+    public float meanArterialPressure = 93f; // Baroreflex set point, mmHg
+    public float respiratoryRate = 14f;
+    public float temperature = 37f;
+    public float glucose = 100f;             // mg/dL
+    public float bloodVolume = 5000f;        // mL
+}
+
+/// <summary>
+/// Lumped model of every simulated patient, stored as structure of arrays and advanced in fixed steps.
+/// Blood volume sets stroke volume; cardiac output against vascular resistance gives arterial
+/// pressure; a baroreflex drives heart rate and resistance to hold the pressure set point.
+/// Ventilation sets alveolar and arterial oxygen and so SpO2, and hypoxia feeds back on breathing
+/// and heart rate. Drugs decay exponentially and act through saturating effect curves.
+/// All vitals therefore move together: a bleed drops pressure, the heart speeds up to compensate,
+/// and a large enough loss ends in arrest.
+/// Pure C# with no Unity calls, so it can be stepped off the main thread.
+/// </summary>
+public class PhysiologyModel
+{
+    public const float StepSeconds = 0.02f;
+
+    // Drug pharmacology: half-life (s) and concentration giving half the maximum effect
+    private static readonly float[] HalfLives = { 120f, 900f, 300f, 0f };
+    private static readonly float[] HalfEffect = { 0.5f, 10f, 0.2f, 1f };
+    private const int DrugCount = 3; // Dextrose acts directly on glucose and is not tracked
+
+    private const float StrokeVolume = 70f;      // mL at baseline volume
+    private const float ArterialCompliance = 1.5f; // mL/mmHg; sets pulse pressure
+    private const float VenousPressure = 5f;
+    private const float AaGradient = 10f;
+    private const float ArrestPressure = 30f;    // MAP below this for ArrestDelay stops the heart
+    private const float ArrestDelay = 30f;
+
+    public int Capacity { get; private set; }
+
+    // Baselines
+    private float[] baseHeartRate, baseMap, baseRespiratoryRate, baseGlucose, baseVolume, baseResistance;
+    // Inputs
+    private float[] bleedRate, infusionRate, fio2, temperatureSetPoint;
+    private float[] drugs; // [slot * DrugCount + drug]
+    // State
+    private float[] volume, tone, map, heartRate, respiratoryRate, paO2, temperature, glucose, lowPressureTime;
+    private bool[] arrested;
+    private bool[] inUse;
+    // Outputs
+    private float[] systolic, diastolic, spO2;
+
+    private readonly float[] drugDecay = new float[DrugCount];
+
+    public PhysiologyModel(int capacity)
+    {
+        for (int d = 0; d < DrugCount; d++)
+            drugDecay[d] = (float)Math.Exp(-StepSeconds * Math.Log(2) / HalfLives[d]);
+        Grow(Math.Max(1, capacity));
+    }
+
+    public bool InUse(int slot) => slot >= 0 && slot < Capacity && inUse[slot];
+
+    /// <summary>
+    /// Start a patient in a free slot at steady state; returns the slot
+    /// </summary>
+    public int Add(PhysiologyProfile profile)
+    {
+        int slot = Array.IndexOf(inUse, false);
+        if (slot < 0)
+        {
+            slot = Capacity;
+            Grow(Capacity * 2);
+        }
+
+        inUse[slot] = true;
+        Reset(slot, profile);
+        return slot;
+    }
+
+    public void Remove(int slot)
+    {
+        if (InUse(slot))
+            inUse[slot] = false;
+    }
+
+    public void Reset(int slot, PhysiologyProfile profile)
+    {
+        baseHeartRate[slot] = profile.heartRate;
+        baseMap[slot] = profile.meanArterialPressure;
+        baseRespiratoryRate[slot] = profile.respiratoryRate;
+        baseGlucose[slot] = profile.glucose;
+        baseVolume[slot] = Math.Max(1000f, profile.bloodVolume);
+        baseResistance[slot] = (profile.meanArterialPressure - VenousPressure) / (profile.heartRate * StrokeVolume / 1000f);
+
+        bleedRate[slot] = 0f;
+        infusionRate[slot] = 0f;
+        fio2[slot] = 0.21f;
+        temperatureSetPoint[slot] = profile.temperature;
+        for (int d = 0; d < DrugCount; d++)
+            drugs[slot * DrugCount + d] = 0f;
+
+        volume[slot] = baseVolume[slot];
+        tone[slot] = 0f;
+        map[slot] = profile.meanArterialPressure;
+        heartRate[slot] = profile.heartRate;
+        respiratoryRate[slot] = profile.respiratoryRate;
+        paO2[slot] = AlveolarOxygen(0.21f, 1f);
+        temperature[slot] = profile.temperature;
+        glucose[slot] = profile.glucose;
+        lowPressureTime[slot] = 0f;
+        arrested[slot] = false;
+        UpdateOutputs(slot);
+    }
+
+    // Procedure events
+
+    public void BloodLoss(int slot, float millilitres) { if (InUse(slot)) volume[slot] = Math.Max(0f, volume[slot] - millilitres); }
+    public void Infuse(int slot, float millilitres) { if (InUse(slot)) volume[slot] += Math.Max(0f, millilitres); }
+    public void SetBleedRate(int slot, float millilitresPerMinute) { if (InUse(slot)) bleedRate[slot] = Math.Max(0f, millilitresPerMinute) / 60f; }
+    public void SetInfusionRate(int slot, float millilitresPerMinute) { if (InUse(slot)) infusionRate[slot] = Math.Max(0f, millilitresPerMinute) / 60f; }
+    public void SetOxygen(int slot, float fractionInspired) { if (InUse(slot)) fio2[slot] = Math.Min(1f, Math.Max(0.21f, fractionInspired)); }
+    public void SetTemperatureSetPoint(int slot, float celsius) { if (InUse(slot)) temperatureSetPoint[slot] = celsius; }
+
+    public void Inject(int slot, PhysiologyDrug drug, float dose)
+    {
+        if (!InUse(slot) || dose <= 0f)
+            return;
+
+        if (drug == PhysiologyDrug.Dextrose)
+            glucose[slot] += dose * 4f; // ~100 mg/dL for an ampoule of D50
+        else
+            drugs[slot * DrugCount + (int)drug] += dose;
+    }
+
+    // Readouts
+
+    public float HeartRate(int slot) => heartRate[slot];
+    public float Systolic(int slot) => systolic[slot];
+    public float Diastolic(int slot) => diastolic[slot];
+    public float MeanArterialPressure(int slot) => map[slot];
+    public float SpO2(int slot) => spO2[slot];
+    public float RespiratoryRate(int slot) => respiratoryRate[slot];
+    public float Temperature(int slot) => temperature[slot];
+    public float Glucose(int slot) => glucose[slot];
+    public float BloodVolume(int slot) => volume[slot];
+    public bool Arrested(int slot) => arrested[slot];
+
+    public ECGSignalGenerator.HeartCondition Rhythm(int slot)
+    {
+        if (arrested[slot])
+            return ECGSignalGenerator.HeartCondition.Flatline;
+        if (spO2[slot] < 75f || Effect(slot, PhysiologyDrug.Epinephrine) > 0.8f)
+            return ECGSignalGenerator.HeartCondition.Arrhythmia;
+        if (heartRate[slot] > 100f)
+            return ECGSignalGenerator.HeartCondition.Tachycardia;
+        if (heartRate[slot] < 60f)
+            return ECGSignalGenerator.HeartCondition.Bradycardia;
+        return ECGSignalGenerator.HeartCondition.Normal;
+    }
+
+    /// <summary>
+    /// Advance every patient by steps fixed steps
+    /// </summary>
+    public void Step(int steps)
+    {
+        float dt = StepSeconds;
+        float toneRate = 1f - (float)Math.Exp(-dt / 3f);
+        float pressureRate = 1f - (float)Math.Exp(-dt / 2f);
+        float breathingRate = 1f - (float)Math.Exp(-dt / 5f);
+        float oxygenRate = 1f - (float)Math.Exp(-dt / 15f);
+        float temperatureRate = 1f - (float)Math.Exp(-dt / 600f);
+        float glucoseRate = 1f - (float)Math.Exp(-dt / 1800f);
+
+        for (int s = 0; s < steps; s++)
+        {
+            for (int i = 0; i < Capacity; i++)
+            {
+                if (!inUse[i])
+                    continue;
+
+                for (int d = 0; d < DrugCount; d++)
+                    drugs[i * DrugCount + d] *= drugDecay[d];
+
+                float epinephrine = Effect(i, PhysiologyDrug.Epinephrine);
+                float morphine = Effect(i, PhysiologyDrug.Morphine);
+                float phenylephrine = Effect(i, PhysiologyDrug.Phenylephrine);
+
+                volume[i] = Math.Max(0f, volume[i] + (infusionRate[i] - bleedRate[i]) * dt);
+
+                float hypoxia = Clamp((92f - spO2[i]) / 20f, 0f, 1f);
+
+                if (arrested[i])
+                {
+                    heartRate[i] = 0f;
+                    respiratoryRate[i] += (0f - respiratoryRate[i]) * breathingRate;
+                    map[i] += (VenousPressure - map[i]) * pressureRate;
+                }
+                else
+                {
+                    // Baroreflex: sympathetic tone rises as pressure falls below the set point
+                    float error = (baseMap[i] - map[i]) / baseMap[i];
+                    tone[i] += (Clamp(error * 4f, -0.5f, 1.5f) - tone[i]) * toneRate;
+
+                    float preload = Clamp(volume[i] / baseVolume[i], 0f, 1.3f);
+                    float stroke = StrokeVolume * preload * (float)Math.Sqrt(preload) * (1f + 0.3f * epinephrine);
+
+                    float rate = baseHeartRate[i] * (1f + 0.6f * tone[i] + 0.4f * hypoxia + 0.8f * epinephrine - 0.3f * morphine);
+                    if (spO2[i] < 70f)
+                        rate *= Clamp((spO2[i] - 40f) / 30f, 0f, 1f); // Hypoxic bradycardia before arrest
+                    heartRate[i] = Clamp(rate, 0f, 190f);
+
+                    float resistance = baseResistance[i] * (1f + 0.5f * tone[i] + 0.6f * phenylephrine + 0.4f * epinephrine);
+                    float output = heartRate[i] * stroke / 1000f;
+                    map[i] += (output * resistance + VenousPressure - map[i]) * pressureRate;
+
+                    float breathing = baseRespiratoryRate[i] * (1f + 1.2f * hypoxia + 0.2f * Math.Max(0f, tone[i])) * (1f - 0.6f * morphine);
+                    respiratoryRate[i] += (Clamp(breathing, 0f, 45f) - respiratoryRate[i]) * breathingRate;
+
+                    lowPressureTime[i] = map[i] < ArrestPressure || heartRate[i] <= 0f ? lowPressureTime[i] + dt : 0f;
+                    arrested[i] = lowPressureTime[i] >= ArrestDelay;
+                }
+
+                // Gas exchange: ventilation relative to baseline sets CO2 and so alveolar O2
+                float ventilation = baseRespiratoryRate[i] > 0f ? respiratoryRate[i] / baseRespiratoryRate[i] : 0f;
+                paO2[i] += (AlveolarOxygen(fio2[i], ventilation) - paO2[i]) * oxygenRate;
+
+                temperature[i] += (temperatureSetPoint[i] - temperature[i]) * temperatureRate;
+                glucose[i] += (baseGlucose[i] - glucose[i]) * glucoseRate;
+
+                UpdateOutputs(i);
+            }
+        }
+    }
+
+    private void UpdateOutputs(int i)
+    {
+        float stroke = heartRate[i] > 0f ? StrokeVolume * Clamp(volume[i] / baseVolume[i], 0f, 1.3f) : 0f;
+        float pulse = stroke / ArterialCompliance;
+        systolic[i] = Math.Max(0f, map[i] + pulse * 2f / 3f);
+        diastolic[i] = Math.Max(0f, map[i] - pulse / 3f);
+
+        // Severinghaus approximation of the oxygen dissociation curve
+        float p = Math.Max(1f, paO2[i]);
+        spO2[i] = 100f / (23400f / (p * p * p + 150f * p) + 1f);
+    }
+
+    private float Effect(int slot, PhysiologyDrug drug)
+    {
+        float concentration = drugs[slot * DrugCount + (int)drug];
+        return concentration / (concentration + HalfEffect[(int)drug]);
+    }
+
+    /// <summary>
+    /// Arterial O2 from the alveolar gas equation, with CO2 inversely proportional to ventilation
+    /// </summary>
+    private static float AlveolarOxygen(float fractionInspired, float ventilation)
+    {
+        float paCO2 = Clamp(40f / Math.Max(ventilation, 0.05f), 20f, 150f);
+        return Math.Max(0f, fractionInspired * (760f - 47f) - paCO2 / 0.8f - AaGradient);
+    }
+
+    private static float Clamp(float value, float min, float max)
+    {
+        return value < min ? min : value > max ? max : value;
+    }
+
+    private void Grow(int capacity)
+    {
+        Capacity = capacity;
+        Array.Resize(ref baseHeartRate, capacity);
+        Array.Resize(ref baseMap, capacity);
+        Array.Resize(ref baseRespiratoryRate, capacity);
+        Array.Resize(ref baseGlucose, capacity);
+        Array.Resize(ref baseVolume, capacity);
+        Array.Resize(ref baseResistance, capacity);
+        Array.Resize(ref bleedRate, capacity);
+        Array.Resize(ref infusionRate, capacity);
+        Array.Resize(ref fio2, capacity);
+        Array.Resize(ref temperatureSetPoint, capacity);
+        Array.Resize(ref drugs, capacity * DrugCount);
+        Array.Resize(ref volume, capacity);
+        Array.Resize(ref tone, capacity);
+        Array.Resize(ref map, capacity);
+        Array.Resize(ref heartRate, capacity);
+        Array.Resize(ref respiratoryRate, capacity);
+        Array.Resize(ref paO2, capacity);
+        Array.Resize(ref temperature, capacity);
+        Array.Resize(ref glucose, capacity);
+        Array.Resize(ref lowPressureTime, capacity);
+        Array.Resize(ref arrested, capacity);
+        Array.Resize(ref inUse, capacity);
+        Array.Resize(ref systolic, capacity);
+        Array.Resize(ref diastolic, capacity);
+        Array.Resize(ref spO2, capacity);
+    }
+}
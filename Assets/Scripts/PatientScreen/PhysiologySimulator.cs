@@ -0,0 +1,287 @@
+// PhysiologySimulator.cs - Steps the PhysiologyModel on a worker thread and publishes vitals
+using UnityEngine;
+using System.Collections.Generic;
+using System.Threading;
+using System;
+
+/// <summary>
+/// Local source of correlated vitals for any number of simulated patients.
+/// Each frame the main thread collects the previous step's results, applies queued procedure
+/// events, and hands the elapsed time to a worker thread that advances the PhysiologyModel in
+/// fixed steps while the rest of the frame runs. The model is only touched by one thread at a
+/// time, so no locking is needed beyond the hand-off.
+/// Subscribers receive a VitalSignsData (reused per patient) every publishInterval.
+/// </summary>
+[DefaultExecutionOrder(-60)]
+public class PhysiologySimulator : MonoBehaviour
+{
+    [Header("Simulation")]
+    public float timeScale = 1f;
+    public float maxStepSeconds = 0.25f; // Simulated time per frame is capped so a hitch can't stall the worker
+
+    private static PhysiologySimulator instance;
+
+    private class Patient
+    {
+        public Action<VitalSignsData> onVitals;
+        public float publishInterval;
+        public float nextPublish;
+        public readonly VitalSignsData vitals = new VitalSignsData { bloodPressure = new BloodPressure(), deviceStatus = "simulated" };
+        public ECGSignalGenerator.HeartCondition rhythm;
+    }
+
+    private enum CommandType { BloodLoss, Infuse, BleedRate, InfusionRate, Oxygen, Temperature, Inject, Reset, Remove }
+
+    private struct Command
+    {
+        public CommandType type;
+        public int slot;
+        public float value;
+        public PhysiologyDrug drug;
+        public PhysiologyProfile profile;
+    }
+
+    private readonly PhysiologyModel model = new PhysiologyModel(8);
+    private readonly Dictionary<int, Patient> patients = new Dictionary<int, Patient>();
+    private readonly List<Command> commands = new List<Command>();
+    private readonly List<int> publishing = new List<int>();
+
+    // Worker hand-off
+    private Thread worker;
+    private readonly AutoResetEvent stepRequested = new AutoResetEvent(false);
+    private readonly ManualResetEvent stepDone = new ManualResetEvent(true);
+    private volatile bool stopping = false;
+    private int pendingSteps = 0;
+    private float stepRemainder = 0f;
+    private double lastStepMilliseconds = 0;
+
+    public static PhysiologySimulator Instance
+    {
+        get
+        {
+            if (instance == null)
+            {
+                instance = FindObjectOfType<PhysiologySimulator>();
+                if (instance == null)
+                {
+                    instance = new GameObject("PhysiologySimulator").AddComponent<PhysiologySimulator>();
+                }
+            }
+            return instance;
+        }
+    }
+
+    public static bool HasInstance => instance != null;
+
+    /// <summary>
+    /// Worker time spent on the last frame's steps, for profiling
+    /// </summary>
+    public double LastStepMilliseconds => lastStepMilliseconds;
+
+    private void Awake()
+    {
+        if (instance == null)
+        {
+            instance = this;
+        }
+        else if (instance != this)
+        {
+            Debug.LogWarning("Multiple PhysiologySimulator instances found. Using the first one.");
+        }
+    }
+
+    private void OnEnable()
+    {
+        stopping = false;
+        worker = new Thread(WorkerLoop) { IsBackground = true, Name = "PhysiologySimulator" };
+        worker.Start();
+    }
+
+    private void OnDisable()
+    {
+        stopping = true;
+        stepRequested.Set();
+        worker?.Join();
+        worker = null;
+        stepDone.Set();
+    }
+
+    private void OnDestroy()
+    {
+        if (instance == this)
+        {
+            instance = null;
+        }
+    }
+
+    /// <summary>
+    /// Add a patient at steady state. Returns its handle for events and Unregister.
+    /// </summary>
+    public int Register(PhysiologyProfile profile, float publishInterval, Action<VitalSignsData> onVitals)
+    {
+        stepDone.WaitOne(); // Adding may grow the model's arrays
+
+        int slot = model.Add(profile ?? new PhysiologyProfile());
+        Patient patient = new Patient
+        {
+            onVitals = onVitals,
+            publishInterval = Mathf.Max(0.05f, publishInterval),
+            nextPublish = Time.time
+        };
+        patient.vitals.patientId = profile != null ? profile.patientId : null;
+        patients[slot] = patient;
+        return slot;
+    }
+
+    public void SetPublishInterval(int handle, float publishInterval)
+    {
+        if (patients.TryGetValue(handle, out Patient patient))
+            patient.publishInterval = Mathf.Max(0.05f, publishInterval);
+    }
+
+    public void Unregister(int handle)
+    {
+        if (patients.Remove(handle))
+            Queue(new Command { type = CommandType.Remove, slot = handle });
+    }
+
+    // Procedure events; applied before the next step
+
+    public void BloodLoss(int handle, float millilitres) => Queue(new Command { type = CommandType.BloodLoss, slot = handle, value = millilitres });
+    public void Infuse(int handle, float millilitres) => Queue(new Command { type = CommandType.Infuse, slot = handle, value = millilitres });
+    public void SetBleedRate(int handle, float millilitresPerMinute) => Queue(new Command { type = CommandType.BleedRate, slot = handle, value = millilitresPerMinute });
+    public void SetInfusionRate(int handle, float millilitresPerMinute) => Queue(new Command { type = CommandType.InfusionRate, slot = handle, value = millilitresPerMinute });
+    public void SetOxygen(int handle, float fractionInspired) => Queue(new Command { type = CommandType.Oxygen, slot = handle, value = fractionInspired });
+    public void SetTemperatureSetPoint(int handle, float celsius) => Queue(new Command { type = CommandType.Temperature, slot = handle, value = celsius });
+    public void Inject(int handle, PhysiologyDrug drug, float dose) => Queue(new Command { type = CommandType.Inject, slot = handle, drug = drug, value = dose });
+    public void ResetPatient(int handle, PhysiologyProfile profile) => Queue(new Command { type = CommandType.Reset, slot = handle, profile = profile });
+
+    /// <summary>
+    /// Rhythm matching the patient's last published state
+    /// </summary>
+    public ECGSignalGenerator.HeartCondition GetRhythm(int handle)
+    {
+        return patients.TryGetValue(handle, out Patient patient) ? patient.rhythm : ECGSignalGenerator.HeartCondition.Normal;
+    }
+
+    public VitalSignsData GetVitals(int handle)
+    {
+        return patients.TryGetValue(handle, out Patient patient) ? patient.vitals : null;
+    }
+
+    private void Queue(Command command)
+    {
+        commands.Add(command);
+    }
+
+    private void Update()
+    {
+        // The worker normally finished long ago; if not, let it run on and catch up next frame
+        if (!stepDone.WaitOne(0))
+        {
+            stepRemainder += Time.deltaTime * timeScale;
+            return;
+        }
+
+        Publish();
+        ApplyCommands();
+
+        stepRemainder += Mathf.Min(Time.deltaTime * timeScale, maxStepSeconds);
+        int steps = Mathf.FloorToInt(stepRemainder / PhysiologyModel.StepSeconds);
+        stepRemainder -= steps * PhysiologyModel.StepSeconds;
+        stepRemainder = Mathf.Min(stepRemainder, maxStepSeconds);
+
+        if (steps > 0 && worker != null)
+        {
+            pendingSteps = steps;
+            stepDone.Reset();
+            stepRequested.Set();
+        }
+    }
+
+    private void WorkerLoop()
+    {
+        System.Diagnostics.Stopwatch timer = new System.Diagnostics.Stopwatch();
+        while (true)
+        {
+            stepRequested.WaitOne();
+            if (stopping)
+                return;
+
+            timer.Restart();
+            try
+            {
+                model.Step(pendingSteps);
+            }
+            catch (Exception e)
+            {
+                Debug.LogError($"PhysiologySimulator step failed: {e.Message}");
+            }
+            lastStepMilliseconds = timer.Elapsed.TotalMilliseconds;
+            stepDone.Set();
+        }
+    }
+
+    private void ApplyCommands()
+    {
+        foreach (Command command in commands)
+        {
+            switch (command.type)
+            {
+                case CommandType.BloodLoss: model.BloodLoss(command.slot, command.value); break;
+                case CommandType.Infuse: model.Infuse(command.slot, command.value); break;
+                case CommandType.BleedRate: model.SetBleedRate(command.slot, command.value); break;
+                case CommandType.InfusionRate: model.SetInfusionRate(command.slot, command.value); break;
+                case CommandType.Oxygen: model.SetOxygen(command.slot, command.value); break;
+                case CommandType.Temperature: model.SetTemperatureSetPoint(command.slot, command.value); break;
+                case CommandType.Inject: model.Inject(command.slot, command.drug, command.value); break;
+                case CommandType.Remove: model.Remove(command.slot); break;
+                case CommandType.Reset:
+                    if (model.InUse(command.slot))
+                        model.Reset(command.slot, command.profile ?? new PhysiologyProfile());
+                    break;
+            }
+        }
+        commands.Clear();
+    }
+
+    private void Publish()
+    {
+        float now = Time.time;
+        string timestamp = null; // Shared by every patient published this frame
+
+        publishing.Clear();
+        foreach (KeyValuePair<int, Patient> entry in patients)
+        {
+            if (now >= entry.Value.nextPublish)
+                publishing.Add(entry.Key);
+        }
+
+        // Callbacks may register or unregister patients, so they run after the scan
+        foreach (int slot in publishing)
+        {
+            if (!patients.TryGetValue(slot, out Patient patient))
+                continue;
+
+            patient.nextPublish = now + patient.publishInterval;
+            if (timestamp == null)
+                timestamp = DateTime.UtcNow.ToString("o");
+
+            VitalSignsData vitals = patient.vitals;
+            vitals.heartRate = Mathf.RoundToInt(model.HeartRate(slot));
+            vitals.bloodPressure.systolic = Mathf.RoundToInt(model.Systolic(slot));
+            vitals.bloodPressure.diastolic = Mathf.RoundToInt(model.Diastolic(slot));
+            vitals.oxygenLevel = Mathf.RoundToInt(model.SpO2(slot));
+            vitals.respiratoryRate = Mathf.RoundToInt(model.RespiratoryRate(slot));
+            vitals.temperature = Mathf.Round(model.Temperature(slot) * 10f) / 10f;
+            vitals.glucose = Mathf.RoundToInt(model.Glucose(slot));
+            vitals.bedOccupancy = true;
+            vitals.batteryLevel = 100;
+            vitals.signalStrength = 100;
+            vitals.timestamp = timestamp;
+            patient.rhythm = model.Rhythm(slot);
+
+            patient.onVitals?.Invoke(vitals);
+        }
+    }
+}
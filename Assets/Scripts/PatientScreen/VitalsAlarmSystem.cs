@@ -0,0 +1,472 @@
+// VitalsAlarmSystem.cs - Alarm rules evaluated for every monitored patient in one pass per frame
+using UnityEngine;
+using UnityEngine.Events;
+using System.Collections.Generic;
+using System;
+
+public enum AlarmPriority { Low, Medium, High }
+
+public enum AlarmTest
+{
+    Above,              // value > threshold
+    Below,              // value < threshold
+    RisingFasterThan,   // change per minute > threshold
+    FallingFasterThan   // change per minute < -threshold
+}
+
+[Serializable]
+public class AlarmCondition
+{
+    public VitalChannel channel = VitalChannel.HeartRate;
+    public AlarmTest test = AlarmTest.Above;
+    public float threshold;
+}
+
+/// <summary>
+/// Raised when every condition has held for sustainSeconds; cleared as soon as one stops holding
+/// </summary>
+[Serializable]
+public class AlarmRule
+{
+    public string name = "Alarm";
+    public AlarmPriority priority = AlarmPriority.Medium;
+    public AlarmCondition[] conditions = new AlarmCondition[0];
+    public float sustainSeconds = 0f;
+}
+
+[Serializable]
+public struct VitalsAlarmEvent
+{
+    public string monitorId;
+    public string ruleName;
+    public int ruleIndex;
+    public AlarmPriority priority;
+    public float time; // Time.time of the transition
+}
+
+/// <summary>
+/// Evaluates alarm rules against the latest vitals of every monitor.
+/// Rules are compiled into flat condition arrays and patient values are stored channel-major,
+/// so each condition is one tight loop over all patients rather than a callback per monitor.
+/// Only transitions are reported: OnAlarmRaised when a rule starts holding (after its sustain
+/// time) and OnAlarmCleared when it stops.
+/// </summary>
+[DefaultExecutionOrder(-40)]
+public class VitalsAlarmSystem : MonoBehaviour
+{
+    [Header("Rules")]
+    public AlarmRule[] rules = DefaultRules();
+
+    [Header("Events")]
+    public UnityEvent<VitalsAlarmEvent> OnAlarmRaised;
+    public UnityEvent<VitalsAlarmEvent> OnAlarmCleared;
+
+    private static VitalsAlarmSystem instance;
+
+    private const int ChannelCount = VitalsTimeSeries.ChannelCount;
+
+    // Compiled rules
+    private int[] ruleFirstCondition = new int[0];
+    private int[] ruleConditionCount = new int[0];
+    private float[] ruleSustain = new float[0];
+    private int[] conditionChannel = new int[0];
+    private AlarmTest[] conditionTest = new AlarmTest[0];
+    private float[] conditionThreshold = new float[0];
+    private bool rulesDirty = true;
+
+    // Patients, structure of arrays; per-channel arrays are channel-major: [channel * capacity + slot]
+    private int capacity = 0;
+    private int patientCount = 0;
+    private string[] monitorIds = new string[0];
+    private bool[] hasData = new bool[0];
+    private bool[] hasRate = new bool[0];
+    private float[] sampleTimes = new float[0];
+    private string[] timestamps = new string[0];
+    private float[] values = new float[0];
+    private float[] rates = new float[0];        // Change per minute between the last two samples
+    private readonly Dictionary<string, int> slots = new Dictionary<string, int>();
+
+    // Per (rule, patient): [rule * capacity + slot]
+    private float[] holdingSince = new float[0]; // < 0 while the conditions do not hold
+    private bool[] active = new bool[0];
+
+    private bool[] match = new bool[0];          // Scratch, one per patient
+
+    public static VitalsAlarmSystem Instance
+    {
+        get
+        {
+            if (instance == null)
+            {
+                instance = FindObjectOfType<VitalsAlarmSystem>();
+                if (instance == null)
+                {
+                    instance = new GameObject("VitalsAlarmSystem").AddComponent<VitalsAlarmSystem>();
+                }
+            }
+            return instance;
+        }
+    }
+
+    public static bool HasInstance => instance != null;
+
+    private void Awake()
+    {
+        if (instance == null)
+        {
+            instance = this;
+        }
+        else if (instance != this)
+        {
+            Debug.LogWarning("Multiple VitalsAlarmSystem instances found. Using the first one.");
+        }
+    }
+
+    private void OnDestroy()
+    {
+        if (instance == this)
+        {
+            instance = null;
+        }
+    }
+
+    private void OnValidate()
+    {
+        rulesDirty = true;
+    }
+
+    /// <summary>
+    /// Replace the rule set; active alarms of the old rules are dropped without clear events
+    /// </summary>
+    public void SetRules(AlarmRule[] newRules)
+    {
+        rules = newRules ?? new AlarmRule[0];
+        rulesDirty = true;
+    }
+
+    /// <summary>
+    /// Latest vitals for a monitor; the monitor is registered on its first submission
+    /// </summary>
+    public void Submit(string monitorId, VitalSignsData vitals)
+    {
+        if (string.IsNullOrEmpty(monitorId) || vitals == null)
+            return;
+
+        int slot = GetSlot(monitorId);
+        float now = Time.time;
+
+        // Several managers may show the same monitor; the same reading only counts once
+        if (hasData[slot] && vitals.timestamp != null && vitals.timestamp == timestamps[slot])
+            return;
+        timestamps[slot] = vitals.timestamp;
+
+        Write(slot, VitalChannel.HeartRate, vitals.heartRate, now);
+        Write(slot, VitalChannel.OxygenLevel, vitals.oxygenLevel, now);
+        Write(slot, VitalChannel.Systolic, vitals.bloodPressure != null ? vitals.bloodPressure.systolic : 0f, now);
+        Write(slot, VitalChannel.Diastolic, vitals.bloodPressure != null ? vitals.bloodPressure.diastolic : 0f, now);
+        Write(slot, VitalChannel.RespiratoryRate, vitals.respiratoryRate, now);
+        Write(slot, VitalChannel.Temperature, vitals.temperature, now);
+        Write(slot, VitalChannel.Glucose, vitals.glucose, now);
+
+        if (!hasData[slot])
+            hasRate[slot] = false;
+        else if (now > sampleTimes[slot])
+            hasRate[slot] = true;
+        hasData[slot] = true;
+        sampleTimes[slot] = now;
+    }
+
+    /// <summary>
+    /// Stop evaluating a monitor; its active alarms are cleared
+    /// </summary>
+    public void Unregister(string monitorId)
+    {
+        if (monitorId == null || !slots.TryGetValue(monitorId, out int slot))
+            return;
+
+        if (rulesDirty)
+            CompileRules();
+
+        for (int r = 0; r < ruleSustain.Length; r++)
+        {
+            if (active[r * capacity + slot])
+                Emit(OnAlarmCleared, slot, r);
+        }
+
+        int last = --patientCount;
+        if (slot != last)
+        {
+            monitorIds[slot] = monitorIds[last];
+            hasData[slot] = hasData[last];
+            hasRate[slot] = hasRate[last];
+            sampleTimes[slot] = sampleTimes[last];
+            timestamps[slot] = timestamps[last];
+            for (int c = 0; c < ChannelCount; c++)
+            {
+                values[c * capacity + slot] = values[c * capacity + last];
+                rates[c * capacity + slot] = rates[c * capacity + last];
+            }
+            for (int r = 0; r < ruleSustain.Length; r++)
+            {
+                holdingSince[r * capacity + slot] = holdingSince[r * capacity + last];
+                active[r * capacity + slot] = active[r * capacity + last];
+            }
+            slots[monitorIds[slot]] = slot;
+        }
+
+        monitorIds[last] = null;
+        timestamps[last] = null;
+        slots.Remove(monitorId);
+    }
+
+    public bool IsActive(string monitorId, int ruleIndex)
+    {
+        if (rulesDirty || monitorId == null || !slots.TryGetValue(monitorId, out int slot) || ruleIndex < 0 || ruleIndex >= ruleSustain.Length)
+            return false;
+
+        return active[ruleIndex * capacity + slot];
+    }
+
+    /// <summary>
+    /// Highest priority among the monitor's active alarms, or -1 if none
+    /// </summary>
+    public int HighestActivePriority(string monitorId)
+    {
+        if (rulesDirty || monitorId == null || !slots.TryGetValue(monitorId, out int slot))
+            return -1;
+
+        int highest = -1;
+        for (int r = 0; r < ruleSustain.Length; r++)
+        {
+            if (active[r * capacity + slot])
+                highest = Mathf.Max(highest, (int)rules[r].priority);
+        }
+        return highest;
+    }
+
+    private void Update()
+    {
+        if (rulesDirty)
+            CompileRules();
+
+        float now = Time.time;
+        int n = patientCount;
+
+        for (int r = 0; r < ruleSustain.Length; r++)
+        {
+            // A rule holds where all of its conditions do
+            for (int p = 0; p < n; p++)
+                match[p] = hasData[p];
+
+            int end = ruleFirstCondition[r] + ruleConditionCount[r];
+            for (int k = ruleFirstCondition[r]; k < end; k++)
+            {
+                int column = conditionChannel[k] * capacity;
+                float threshold = conditionThreshold[k];
+
+                switch (conditionTest[k])
+                {
+                    case AlarmTest.Above:
+                        for (int p = 0; p < n; p++)
+                            match[p] &= values[column + p] > threshold;
+                        break;
+                    case AlarmTest.Below:
+                        for (int p = 0; p < n; p++)
+                            match[p] &= values[column + p] < threshold;
+                        break;
+                    case AlarmTest.RisingFasterThan:
+                        for (int p = 0; p < n; p++)
+                            match[p] &= hasRate[p] && rates[column + p] > threshold;
+                        break;
+                    case AlarmTest.FallingFasterThan:
+                        for (int p = 0; p < n; p++)
+                            match[p] &= hasRate[p] && rates[column + p] < -threshold;
+                        break;
+                }
+            }
+
+            // Sustain timers and edges
+            int row = r * capacity;
+            float sustain = ruleSustain[r];
+            for (int p = 0; p < n; p++)
+            {
+                int index = row + p;
+                if (match[p])
+                {
+                    if (holdingSince[index] < 0f)
+                        holdingSince[index] = now;
+
+                    if (!active[index] && now - holdingSince[index] >= sustain)
+                    {
+                        active[index] = true;
+                        Emit(OnAlarmRaised, p, r);
+                    }
+                }
+                else
+                {
+                    holdingSince[index] = -1f;
+                    if (active[index])
+                    {
+                        active[index] = false;
+                        Emit(OnAlarmCleared, p, r);
+                    }
+                }
+            }
+        }
+    }
+
+    private void Emit(UnityEvent<VitalsAlarmEvent> target, int slot, int ruleIndex)
+    {
+        AlarmRule rule = rules[ruleIndex];
+        target?.Invoke(new VitalsAlarmEvent
+        {
+            monitorId = monitorIds[slot],
+            ruleName = rule.name,
+            ruleIndex = ruleIndex,
+            priority = rule.priority,
+            time = Time.time
+        });
+    }
+
+    private void Write(int slot, VitalChannel channel, float value, float now)
+    {
+        int index = (int)channel * capacity + slot;
+        if (hasData[slot] && now > sampleTimes[slot])
+        {
+            rates[index] = (value - values[index]) * 60f / (now - sampleTimes[slot]);
+        }
+        values[index] = value;
+    }
+
+    private int GetSlot(string monitorId)
+    {
+        if (slots.TryGetValue(monitorId, out int slot))
+            return slot;
+
+        if (patientCount == capacity)
+            Grow(Mathf.Max(4, capacity * 2));
+
+        slot = patientCount++;
+        monitorIds[slot] = monitorId;
+        hasData[slot] = false;
+        hasRate[slot] = false;
+        sampleTimes[slot] = 0f;
+        timestamps[slot] = null;
+        for (int r = 0; r < ruleSustain.Length; r++)
+        {
+            holdingSince[r * capacity + slot] = -1f;
+            active[r * capacity + slot] = false;
+        }
+        slots[monitorId] = slot;
+        return slot;
+    }
+
+    /// <summary>
+    /// Per-patient arrays are resized directly; channel- and rule-major ones are re-laid out for the new stride
+    /// </summary>
+    private void Grow(int newCapacity)
+    {
+        Array.Resize(ref monitorIds, newCapacity);
+        Array.Resize(ref hasData, newCapacity);
+        Array.Resize(ref hasRate, newCapacity);
+        Array.Resize(ref sampleTimes, newCapacity);
+        Array.Resize(ref timestamps, newCapacity);
+        Array.Resize(ref match, newCapacity);
+
+        values = Restride(values, ChannelCount, capacity, newCapacity, 0f);
+        rates = Restride(rates, ChannelCount, capacity, newCapacity, 0f);
+        holdingSince = Restride(holdingSince, ruleSustain.Length, capacity, newCapacity, -1f);
+        active = Restride(active, ruleSustain.Length, capacity, newCapacity, false);
+        capacity = newCapacity;
+    }
+
+    private static T[] Restride<T>(T[] source, int rows, int oldStride, int newStride, T fill)
+    {
+        T[] result = new T[rows * newStride];
+        for (int i = 0; i < result.Length; i++)
+            result[i] = fill;
+        for (int row = 0; row < rows; row++)
+            Array.Copy(source, row * oldStride, result, row * newStride, oldStride);
+        return result;
+    }
+
+    private void CompileRules()
+    {
+        rulesDirty = false;
+        if (rules == null)
+            rules = new AlarmRule[0];
+
+        int conditionCount = 0;
+        foreach (AlarmRule rule in rules)
+        {
+            if (rule != null && rule.conditions != null)
+                conditionCount += rule.conditions.Length;
+        }
+
+        ruleFirstCondition = new int[rules.Length];
+        ruleConditionCount = new int[rules.Length];
+        ruleSustain = new float[rules.Length];
+        conditionChannel = new int[conditionCount];
+        conditionTest = new AlarmTest[conditionCount];
+        conditionThreshold = new float[conditionCount];
+
+        int k = 0;
+        for (int r = 0; r < rules.Length; r++)
+        {
+            AlarmRule rule = rules[r];
+            ruleFirstCondition[r] = k;
+            ruleSustain[r] = rule != null ? Mathf.Max(0f, rule.sustainSeconds) : 0f;
+
+            // A rule without conditions never fires
+            if (rule == null || rule.conditions == null || rule.conditions.Length == 0)
+            {
+                ruleConditionCount[r] = 0;
+                ruleSustain[r] = float.PositiveInfinity;
+                continue;
+            }
+
+            foreach (AlarmCondition condition in rule.conditions)
+            {
+                conditionChannel[k] = (int)condition.channel;
+                conditionTest[k] = condition.test;
+                conditionThreshold[k] = condition.threshold;
+                k++;
+            }
+            ruleConditionCount[r] = rule.conditions.Length;
+        }
+
+        // Alarm state is per rule, so a new rule set starts quiet
+        holdingSince = new float[rules.Length * capacity];
+        active = new bool[rules.Length * capacity];
+        for (int i = 0; i < holdingSince.Length; i++)
+            holdingSince[i] = -1f;
+    }
+
+    private static AlarmRule[] DefaultRules()
+    {
+        return new[]
+        {
+            Rule("Tachycardia", AlarmPriority.Medium, 10f, Condition(VitalChannel.HeartRate, AlarmTest.Above, 120f)),
+            Rule("Bradycardia", AlarmPriority.Medium, 10f, Condition(VitalChannel.HeartRate, AlarmTest.Below, 50f)),
+            Rule("Desaturation", AlarmPriority.High, 15f, Condition(VitalChannel.OxygenLevel, AlarmTest.Below, 90f)),
+            Rule("Hypotension", AlarmPriority.High, 10f, Condition(VitalChannel.Systolic, AlarmTest.Below, 90f)),
+            Rule("Hypertension", AlarmPriority.Medium, 30f, Condition(VitalChannel.Systolic, AlarmTest.Above, 180f)),
+            Rule("Tachypnea", AlarmPriority.Low, 30f, Condition(VitalChannel.RespiratoryRate, AlarmTest.Above, 30f)),
+            Rule("Fever", AlarmPriority.Low, 60f, Condition(VitalChannel.Temperature, AlarmTest.Above, 38.5f)),
+            Rule("Rapid HR rise", AlarmPriority.Medium, 0f, Condition(VitalChannel.HeartRate, AlarmTest.RisingFasterThan, 30f)),
+            Rule("Hypoxic tachycardia", AlarmPriority.High, 5f,
+                Condition(VitalChannel.OxygenLevel, AlarmTest.Below, 92f),
+                Condition(VitalChannel.HeartRate, AlarmTest.Above, 110f))
+        };
+    }
+
+    private static AlarmRule Rule(string name, AlarmPriority priority, float sustainSeconds, params AlarmCondition[] conditions)
+    {
+        return new AlarmRule { name = name, priority = priority, sustainSeconds = sustainSeconds, conditions = conditions };
+    }
+
+    private static AlarmCondition Condition(VitalChannel channel, AlarmTest test, float threshold)
+    {
+        return new AlarmCondition { channel = channel, test = test, threshold = threshold };
+    }
+}
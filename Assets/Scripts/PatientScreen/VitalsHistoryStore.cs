@@ -0,0 +1,166 @@
+// VitalsHistoryStore.cs - Per-monitor vitals history for trend graphs
+using UnityEngine;
+using System.Collections.Generic;
+using System.IO;
+using System;
+
+/// <summary>
+/// Keeps a VitalsTimeSeries per monitor: raw samples for the last several minutes plus min/max/mean
+/// rollups for hours. It survives scene loads, and with persistToDisk each series is kept in a
+/// memory-mapped file, so a scenario's history is still there after a reload or restart without
+/// fetching it again.
+/// </summary>
+public class VitalsHistoryStore : MonoBehaviour
+{
+    [Header("Retention")]
+    public int rawCapacity = 900;                      // Raw samples per monitor (15 min at 1 Hz)
+    public int[] rollupSeconds = { 60, 600 };          // Bucket length of each rollup tier
+    public int[] rollupCapacities = { 720, 432 };      // Buckets per tier (12 h of minutes, 72 h of 10 min)
+
+    [Header("Persistence")]
+    public bool persistToDisk = false;
+    public string folderName = "VitalsHistory";        // Under Application.persistentDataPath
+
+    private static VitalsHistoryStore instance;
+
+    private class Entry
+    {
+        public VitalsTimeSeries series;
+        public string lastTimestamp; // Source timestamp of the last sample, so repeated deliveries are skipped
+    }
+
+    private readonly Dictionary<string, Entry> entries = new Dictionary<string, Entry>();
+    private readonly float[] sampleScratch = new float[VitalsTimeSeries.ChannelCount];
+
+    public static VitalsHistoryStore Instance
+    {
+        get
+        {
+            if (instance == null)
+            {
+                instance = FindObjectOfType<VitalsHistoryStore>();
+                if (instance == null)
+                {
+                    instance = new GameObject("VitalsHistoryStore").AddComponent<VitalsHistoryStore>();
+                }
+            }
+            return instance;
+        }
+    }
+
+    public static bool HasInstance => instance != null;
+
+    private void Awake()
+    {
+        if (instance != null && instance != this)
+        {
+            Destroy(gameObject);
+            return;
+        }
+
+        instance = this;
+        DontDestroyOnLoad(gameObject);
+    }
+
+    private void OnDestroy()
+    {
+        if (instance != this)
+            return;
+
+        foreach (Entry entry in entries.Values)
+        {
+            entry.series.Dispose();
+        }
+        entries.Clear();
+        instance = null;
+    }
+
+    /// <summary>
+    /// Record a vitals update for a monitor, stamped with the time it arrived.
+    /// An update whose source timestamp matches the previous one is the same reading and is skipped.
+    /// </summary>
+    public void Record(string monitorId, VitalSignsData vitals)
+    {
+        if (string.IsNullOrEmpty(monitorId) || vitals == null)
+            return;
+
+        Entry entry = GetEntry(monitorId);
+        if (vitals.timestamp != null && vitals.timestamp == entry.lastTimestamp)
+            return;
+
+        entry.lastTimestamp = vitals.timestamp;
+        entry.series.Record(Now(), vitals, sampleScratch);
+    }
+
+    /// <summary>
+    /// Trend of one channel over the last `seconds`, at most maxPoints points written to output
+    /// </summary>
+    public int QueryRecent(string monitorId, VitalChannel channel, double seconds, int maxPoints, TrendPoint[] output)
+    {
+        double now = Now();
+        return Query(monitorId, channel, now - seconds, now, maxPoints, output);
+    }
+
+    public int Query(string monitorId, VitalChannel channel, double from, double to, int maxPoints, TrendPoint[] output)
+    {
+        if (string.IsNullOrEmpty(monitorId) || output == null)
+            return 0;
+
+        return GetEntry(monitorId).series.Query(channel, from, to, maxPoints, output);
+    }
+
+    public VitalsTimeSeries GetSeries(string monitorId)
+    {
+        return GetEntry(monitorId).series;
+    }
+
+    public void Clear(string monitorId)
+    {
+        if (entries.TryGetValue(monitorId, out Entry entry))
+        {
+            entry.series.Clear();
+            entry.lastTimestamp = null;
+        }
+    }
+
+    /// <summary>
+    /// Unix seconds, the time base of every series
+    /// </summary>
+    public static double Now()
+    {
+        return DateTimeOffset.UtcNow.ToUnixTimeMilliseconds() / 1000.0;
+    }
+
+    private Entry GetEntry(string monitorId)
+    {
+        if (!entries.TryGetValue(monitorId, out Entry entry))
+        {
+            if (rollupSeconds.Length != rollupCapacities.Length)
+            {
+                Debug.LogError("VitalsHistoryStore: rollupSeconds and rollupCapacities need one entry per tier");
+                int tiers = Math.Min(rollupSeconds.Length, rollupCapacities.Length);
+                Array.Resize(ref rollupSeconds, tiers);
+                Array.Resize(ref rollupCapacities, tiers);
+            }
+
+            string path = persistToDisk ? Path.Combine(Application.persistentDataPath, folderName, FileNameFor(monitorId)) : null;
+            entry = new Entry
+            {
+                series = new VitalsTimeSeries(rawCapacity, rollupSeconds, rollupCapacities, path)
+            };
+            entries[monitorId] = entry;
+        }
+        return entry;
+    }
+
+    private static string FileNameFor(string monitorId)
+    {
+        char[] name = monitorId.ToCharArray();
+        for (int i = 0; i < name.Length; i++)
+        {
+            if (!char.IsLetterOrDigit(name[i]) && name[i] != '_' && name[i] != '-')
+                name[i] = '_';
+        }
+        return new string(name) + ".vts";
+    }
+}
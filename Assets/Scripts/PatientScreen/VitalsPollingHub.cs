@@ -0,0 +1,680 @@
+// VitalsPollingHub.cs - One scheduler for every vitals poll in the scene
+using UnityEngine;
+using UnityEngine.Networking;
+using System.Collections;
+using System.Collections.Generic;
+using System;
+
+/// <summary>
+/// Central polling service. Every component that used to run its own request loop subscribes here
+/// instead; subscriptions to the same URL share one request, and the response is parsed once and
+/// fanned out. Each subscriber asks for its own refresh interval and a feed polls at the fastest one.
+/// When a stream endpoint is configured, monitor vitals are pushed over Server-Sent Events instead and
+/// polling only runs while the stream is down.
+/// Vitals are decoded from the response bytes into one VitalSignsData per monitor that is reused for
+/// every update; subscribers that keep history should copy the values out.
+/// </summary>
+public class VitalsPollingHub : MonoBehaviour
+{
+    [Header("API Configuration")]
+    public string baseUrl = "https://smarthospitalbackend.onrender.com/iotData/";
+    public string batchUrl = ""; // Optional: endpoint taking ?monitors=a,b,c; empty polls each monitor separately
+    public float tickInterval = 0.25f; // How often the scheduler looks for due feeds
+    public int maxConcurrentRequests = 4;
+    public bool requestBinaryVitals = false; // Ask monitor feeds for the compact delta format; servers without it answer JSON
+
+    [Header("Streaming")]
+    public string streamUrl = ""; // Optional SSE endpoint taking ?monitors=a,b,c; empty disables streaming
+    public float reconnectDelay = 1f; // Doubles after each failed attempt, up to maxReconnectDelay
+    public float maxReconnectDelay = 30f;
+
+    private static VitalsPollingHub instance;
+
+    private class Subscriber
+    {
+        public float interval;
+        public Action<VitalSignsData> onVitals;
+        public Action<string> onText;
+        public Action<string> onError;
+    }
+
+    private class Feed
+    {
+        public string url;
+        public string monitorId; // Set when the URL is a monitor's vitals endpoint, so it can join a batch or stream
+        public bool streamed;    // Covered by the live stream; not polled while it stays up
+        public readonly List<Subscriber> subscribers = new List<Subscriber>();
+        public float interval;
+        public float nextDue;
+        public bool inFlight;
+        public string latestText;
+        public VitalSignsData latestVitals; // Reused; overwritten in place by each decoded update
+        public string etag;                 // Sent back as If-None-Match so unchanged vitals cost a bodiless 304
+        public uint binarySequence;         // Sample latestVitals holds in the binary format; 0 = none, ask for a full frame
+    }
+
+    private readonly Dictionary<string, Feed> feeds = new Dictionary<string, Feed>();
+    private readonly List<Feed> feedList = new List<Feed>();
+    private readonly List<Feed> dueFeeds = new List<Feed>();
+    private int requestsInFlight = 0;
+
+    private readonly VitalsJsonDecoder decoder = new VitalsJsonDecoder();
+    private VitalsJsonDecoder.TargetLookup lookupMonitorVitals;
+    private Action<VitalSignsData> deliverDecodedVitals;
+    private Feed decodingFeed; // Feed matched by the last lookup, delivered once its entry decodes
+
+    // Poll statistics, for comparing wire formats
+    private long polledBytes = 0;
+    private int notModifiedResponses = 0;
+    private double decodeMilliseconds = 0;
+    private readonly System.Diagnostics.Stopwatch decodeTimer = new System.Diagnostics.Stopwatch();
+
+    // Stream state
+    private int monitorSetVersion = 0; // Bumped when a monitor feed is added or removed, forcing a reconnect
+    private bool streamConnected = false;
+    private VitalsStreamHandler streamHandler;
+    private long closedStreamBytes = 0;
+    private int streamEvents = 0;
+    private float lastStreamLatencyMs = -1f;
+
+    public static VitalsPollingHub Instance
+    {
+        get
+        {
+            if (instance == null)
+            {
+                instance = FindObjectOfType<VitalsPollingHub>();
+                if (instance == null)
+                {
+                    instance = new GameObject("VitalsPollingHub").AddComponent<VitalsPollingHub>();
+                }
+            }
+            return instance;
+        }
+    }
+
+    /// <summary>
+    /// True while the push stream is delivering monitor vitals
+    /// </summary>
+    public bool IsStreaming => streamConnected;
+
+    public long StreamBytesReceived => closedStreamBytes + (streamHandler != null ? streamHandler.BytesReceived : 0);
+    public int StreamEventsReceived => streamEvents;
+
+    /// <summary>
+    /// Server send time to delivery, from the event id (sender clock, Unix ms); -1 until measured
+    /// </summary>
+    public float LastStreamLatencyMs => lastStreamLatencyMs;
+
+    /// <summary>
+    /// Response body bytes received by polls (not the stream), 304s and total vitals decode time
+    /// </summary>
+    public long PolledBytesReceived => polledBytes;
+    public int NotModifiedResponses => notModifiedResponses;
+    public double DecodeMilliseconds => decodeMilliseconds;
+
+    /// <summary>
+    /// True while a hub exists; lets subscribers unsubscribe during teardown without creating a new one
+    /// </summary>
+    public static bool HasInstance => instance != null;
+
+    private void Awake()
+    {
+        // Cached once so batch and stream decoding do not allocate delegates per response
+        lookupMonitorVitals = LookupMonitorVitals;
+        deliverDecodedVitals = DeliverDecodedVitals;
+
+        if (instance == null)
+        {
+            instance = this;
+        }
+        else if (instance != this)
+        {
+            Debug.LogWarning("Multiple VitalsPollingHub instances found. Using the first one.");
+        }
+    }
+
+    private void Start()
+    {
+        StartCoroutine(SchedulerRoutine());
+        StartCoroutine(StreamRoutine());
+    }
+
+    private void OnDestroy()
+    {
+        if (instance == this)
+        {
+            instance = null;
+        }
+    }
+
+    public string GetVitalsUrl(string monitorId)
+    {
+        return baseUrl + monitorId + "/vitals/latest";
+    }
+
+    /// <summary>
+    /// Receive parsed vitals for a monitor every interval seconds (or faster if another subscriber asks)
+    /// </summary>
+    public void SubscribeVitals(string monitorId, float interval, Action<VitalSignsData> onVitals, Action<string> onError = null)
+    {
+        SubscribeVitalsUrl(GetVitalsUrl(monitorId), interval, onVitals, onError);
+    }
+
+    public void UnsubscribeVitals(string monitorId, Action<VitalSignsData> onVitals)
+    {
+        Unsubscribe(GetVitalsUrl(monitorId), onVitals, null);
+    }
+
+    /// <summary>
+    /// Same as SubscribeVitals for a full endpoint URL; URLs under baseUrl share the monitor's feed
+    /// </summary>
+    public void SubscribeVitalsUrl(string url, float interval, Action<VitalSignsData> onVitals, Action<string> onError = null)
+    {
+        if (onVitals == null)
+            return;
+
+        Subscriber subscriber = FindOrAddSubscriber(url, onVitals, null);
+        subscriber.interval = interval;
+        subscriber.onError = onError;
+        Refresh(url, subscriber);
+    }
+
+    public void UnsubscribeVitalsUrl(string url, Action<VitalSignsData> onVitals)
+    {
+        Unsubscribe(url, onVitals, null);
+    }
+
+    /// <summary>
+    /// Receive the raw response body of any endpoint, for payloads other than VitalSignsResponse
+    /// </summary>
+    public void SubscribeUrl(string url, float interval, Action<string> onText, Action<string> onError = null)
+    {
+        if (onText == null)
+            return;
+
+        Subscriber subscriber = FindOrAddSubscriber(url, null, onText);
+        subscriber.interval = interval;
+        subscriber.onError = onError;
+        Refresh(url, subscriber);
+    }
+
+    public void UnsubscribeUrl(string url, Action<string> onText)
+    {
+        Unsubscribe(url, null, onText);
+    }
+
+    /// <summary>
+    /// Last vitals received for a monitor, or null if none yet
+    /// </summary>
+    public VitalSignsData GetLatestVitals(string monitorId)
+    {
+        return feeds.TryGetValue(GetVitalsUrl(monitorId), out Feed feed) ? feed.latestVitals : null;
+    }
+
+    // Subscriptions
+
+    private Subscriber FindOrAddSubscriber(string url, Action<VitalSignsData> onVitals, Action<string> onText)
+    {
+        if (!feeds.TryGetValue(url, out Feed feed))
+        {
+            feed = new Feed { url = url, monitorId = ParseMonitorId(url), nextDue = Time.time };
+            feeds.Add(url, feed);
+            feedList.Add(feed);
+
+            if (feed.monitorId != null)
+                monitorSetVersion++;
+        }
+
+        // A component subscribing twice only updates its interval
+        foreach (Subscriber existing in feed.subscribers)
+        {
+            if ((onVitals != null && existing.onVitals == onVitals) || (onText != null && existing.onText == onText))
+                return existing;
+        }
+
+        Subscriber subscriber = new Subscriber { onVitals = onVitals, onText = onText };
+        feed.subscribers.Add(subscriber);
+        return subscriber;
+    }
+
+    private void Unsubscribe(string url, Action<VitalSignsData> onVitals, Action<string> onText)
+    {
+        if (!feeds.TryGetValue(url, out Feed feed))
+            return;
+
+        feed.subscribers.RemoveAll(s => (onVitals != null && s.onVitals == onVitals) || (onText != null && s.onText == onText));
+
+        if (feed.subscribers.Count == 0)
+        {
+            feeds.Remove(url);
+            feedList.Remove(feed);
+
+            if (feed.monitorId != null)
+                monitorSetVersion++;
+        }
+        else
+        {
+            UpdateFeedInterval(feed);
+        }
+    }
+
+    private void Refresh(string url, Subscriber subscriber)
+    {
+        Feed feed = feeds[url];
+        float previousInterval = feed.interval;
+        UpdateFeedInterval(feed);
+
+        // A faster subscriber should not wait out the old, slower interval
+        if (feed.interval < previousInterval)
+            feed.nextDue = Mathf.Min(feed.nextDue, Time.time + feed.interval);
+
+        // Late subscribers get the last response straight away instead of waiting for the next poll
+        if (subscriber.onVitals != null && feed.latestVitals != null)
+            subscriber.onVitals(feed.latestVitals);
+        if (subscriber.onText != null && feed.latestText != null)
+            subscriber.onText(feed.latestText);
+    }
+
+    private void UpdateFeedInterval(Feed feed)
+    {
+        float interval = float.MaxValue;
+        foreach (Subscriber subscriber in feed.subscribers)
+            interval = Mathf.Min(interval, subscriber.interval);
+
+        feed.interval = Mathf.Max(tickInterval, interval);
+    }
+
+    private string ParseMonitorId(string url)
+    {
+        const string suffix = "/vitals/latest";
+        if (!url.StartsWith(baseUrl, StringComparison.Ordinal) || !url.EndsWith(suffix, StringComparison.Ordinal))
+            return null;
+
+        string monitorId = url.Substring(baseUrl.Length, url.Length - baseUrl.Length - suffix.Length);
+        return monitorId.Length > 0 && monitorId.IndexOf('/') < 0 ? monitorId : null;
+    }
+
+    // Scheduling
+
+    private IEnumerator SchedulerRoutine()
+    {
+        WaitForSeconds wait = new WaitForSeconds(tickInterval);
+
+        while (true)
+        {
+            CollectDueFeeds();
+
+            if (dueFeeds.Count > 0)
+            {
+                if (!string.IsNullOrEmpty(batchUrl))
+                    StartBatchRequest();
+
+                // Feeds a batch cannot cover (or every feed, without a batch endpoint)
+                foreach (Feed feed in dueFeeds)
+                {
+                    if (feed.inFlight)
+                        continue;
+                    if (requestsInFlight >= maxConcurrentRequests)
+                        break;
+
+                    StartCoroutine(FetchFeed(feed));
+                }
+            }
+
+            yield return wait;
+        }
+    }
+
+    private void CollectDueFeeds()
+    {
+        dueFeeds.Clear();
+        float now = Time.time;
+
+        foreach (Feed feed in feedList)
+        {
+            if (feed.streamed && streamConnected)
+                continue;
+
+            if (!feed.inFlight && now >= feed.nextDue)
+                dueFeeds.Add(feed);
+        }
+    }
+
+    private void StartBatchRequest()
+    {
+        List<Feed> batch = null;
+        foreach (Feed feed in dueFeeds)
+        {
+            if (feed.monitorId == null)
+                continue;
+
+            if (batch == null)
+                batch = new List<Feed>();
+            batch.Add(feed);
+            feed.inFlight = true;
+        }
+
+        if (batch != null)
+            StartCoroutine(FetchBatch(batch));
+    }
+
+    private IEnumerator FetchFeed(Feed feed)
+    {
+        feed.inFlight = true;
+        requestsInFlight++;
+
+        using (UnityWebRequest request = UnityWebRequest.Get(feed.url))
+        {
+            bool binary = requestBinaryVitals && feed.monitorId != null && !HasTextSubscribers(feed);
+            if (binary)
+            {
+                request.SetRequestHeader("accept", VitalsBinaryCodec.ContentType + ", application/json");
+                if (feed.binarySequence != 0)
+                    request.SetRequestHeader(VitalsBinaryCodec.BaseHeader, feed.binarySequence.ToString());
+            }
+            else
+            {
+                request.SetRequestHeader("accept", "application/json");
+            }
+
+            if (feed.etag != null)
+                request.SetRequestHeader("If-None-Match", feed.etag);
+
+            yield return request.SendWebRequest();
+
+            if (request.responseCode == 304)
+            {
+                // Unchanged since the last response; nothing to deliver
+                notModifiedResponses++;
+            }
+            else if (request.result == UnityWebRequest.Result.Success)
+            {
+                polledBytes += (long)request.downloadedBytes;
+                feed.etag = request.GetResponseHeader("ETag");
+
+                bool hasVitals = false;
+                if (HasVitalsSubscribers(feed))
+                    hasVitals = DecodeFeedVitals(feed, request);
+
+                // Only pay for the managed string when a raw-text subscriber needs it
+                string text = HasTextSubscribers(feed) ? request.downloadHandler.text : null;
+                Deliver(feed, text, hasVitals);
+            }
+            else
+            {
+                DeliverError(feed, request.error);
+            }
+        }
+
+        requestsInFlight--;
+        feed.inFlight = false;
+        feed.nextDue = Time.time + feed.interval;
+    }
+
+    private bool DecodeFeedVitals(Feed feed, UnityWebRequest request)
+    {
+        if (feed.latestVitals == null)
+            feed.latestVitals = new VitalSignsData();
+
+        ReadOnlySpan<byte> body = request.downloadHandler.nativeData.AsReadOnlySpan();
+        string contentType = request.GetResponseHeader("Content-Type");
+        bool ok;
+
+        decodeTimer.Restart();
+        if (contentType != null && contentType.StartsWith(VitalsBinaryCodec.ContentType, StringComparison.OrdinalIgnoreCase))
+        {
+            ok = VitalsBinaryCodec.TryDecode(body, feed.latestVitals, ref feed.binarySequence);
+        }
+        else
+        {
+            ok = decoder.TryDecodeResponse(body, feed.latestVitals);
+            feed.binarySequence = 0;
+        }
+        decodeTimer.Stop();
+        decodeMilliseconds += decodeTimer.Elapsed.TotalMilliseconds;
+
+        if (!ok)
+        {
+            // Start over with a full response next time (a delta may have been against another base)
+            Debug.LogError($"Malformed vitals response for {feed.url}");
+            feed.binarySequence = 0;
+            feed.etag = null;
+        }
+        return ok;
+    }
+
+    private IEnumerator FetchBatch(List<Feed> batch)
+    {
+        string[] monitorIds = new string[batch.Count];
+        for (int i = 0; i < batch.Count; i++)
+            monitorIds[i] = batch[i].monitorId;
+
+        string url = batchUrl + "?monitors=" + UnityWebRequest.EscapeURL(string.Join(",", monitorIds));
+        requestsInFlight++;
+
+        using (UnityWebRequest request = UnityWebRequest.Get(url))
+        {
+            request.SetRequestHeader("accept", "application/json");
+
+            yield return request.SendWebRequest();
+
+            if (request.result == UnityWebRequest.Result.Success)
+            {
+                if (decoder.TryDecodeBatch(request.downloadHandler.nativeData.AsReadOnlySpan(), lookupMonitorVitals, deliverDecodedVitals) < 0)
+                    Debug.LogError("Malformed batched vitals response");
+            }
+            else
+            {
+                foreach (Feed feed in batch)
+                    DeliverError(feed, request.error);
+            }
+        }
+
+        requestsInFlight--;
+        foreach (Feed feed in batch)
+        {
+            feed.inFlight = false;
+            feed.nextDue = Time.time + feed.interval;
+        }
+    }
+
+    // Streaming
+
+    private IEnumerator StreamRoutine()
+    {
+        WaitForSeconds idle = new WaitForSeconds(tickInterval);
+        float backoff = reconnectDelay;
+
+        while (true)
+        {
+            string monitors = string.IsNullOrEmpty(streamUrl) ? null : JoinMonitorIds();
+            if (monitors == null)
+            {
+                yield return idle;
+                continue;
+            }
+
+            int version = monitorSetVersion;
+            streamHandler = new VitalsStreamHandler(OnStreamEvent);
+
+            using (UnityWebRequest request = new UnityWebRequest(streamUrl + "?monitors=" + UnityWebRequest.EscapeURL(monitors), "GET", streamHandler, null))
+            {
+                request.SetRequestHeader("accept", "text/event-stream");
+                request.SendWebRequest();
+
+                // The request only completes when the stream drops; watch it instead of yielding on it
+                while (!request.isDone && version == monitorSetVersion)
+                {
+                    if (!streamConnected && streamHandler.EventsReceived > 0)
+                    {
+                        SetStreamConnected(true);
+                        backoff = reconnectDelay;
+                    }
+                    yield return null;
+                }
+
+                if (!request.isDone)
+                {
+                    request.Abort();
+                }
+                else if (request.result != UnityWebRequest.Result.Success)
+                {
+                    Debug.LogWarning($"Vitals stream dropped: {request.error}. Polling until it reconnects.");
+                }
+
+                closedStreamBytes += streamHandler.BytesReceived;
+                streamHandler = null;
+            }
+
+            SetStreamConnected(false);
+
+            // The monitor set changed: reconnect with the new list after one tick, so a burst of
+            // subscriptions (scene load) causes one reconnect instead of many
+            if (version != monitorSetVersion)
+            {
+                yield return idle;
+                continue;
+            }
+
+            yield return new WaitForSeconds(backoff);
+            backoff = Mathf.Min(backoff * 2f, maxReconnectDelay);
+        }
+    }
+
+    private string JoinMonitorIds()
+    {
+        List<string> monitorIds = null;
+        foreach (Feed feed in feedList)
+        {
+            if (feed.monitorId == null)
+                continue;
+
+            if (monitorIds == null)
+                monitorIds = new List<string>();
+            monitorIds.Add(feed.monitorId);
+        }
+        return monitorIds != null ? string.Join(",", monitorIds) : null;
+    }
+
+    private void SetStreamConnected(bool connected)
+    {
+        if (streamConnected == connected)
+            return;
+
+        streamConnected = connected;
+        float now = Time.time;
+
+        foreach (Feed feed in feedList)
+        {
+            feed.streamed = connected && feed.monitorId != null;
+
+            // Fall back to polling right away rather than after a full interval
+            if (!connected && feed.monitorId != null)
+                feed.nextDue = now;
+        }
+
+        Debug.Log(connected ? "Vitals stream connected" : "Vitals stream disconnected");
+    }
+
+    private void OnStreamEvent(long id, ReadOnlySpan<byte> data)
+    {
+        streamEvents++;
+
+        if (id >= 0)
+            lastStreamLatencyMs = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds() - id;
+
+        if (!decoder.TryDecodeEntry(data, lookupMonitorVitals, deliverDecodedVitals))
+            Debug.LogError("Malformed streamed vitals event");
+    }
+
+    // Fan-out
+
+    private VitalSignsData LookupMonitorVitals(ReadOnlySpan<byte> monitorId)
+    {
+        decodingFeed = null;
+        foreach (Feed feed in feedList)
+        {
+            if (feed.monitorId != null && JsonByteReader.NameIs(monitorId, feed.monitorId))
+            {
+                if (feed.latestVitals == null)
+                    feed.latestVitals = new VitalSignsData();
+
+                decodingFeed = feed;
+                return feed.latestVitals;
+            }
+        }
+        return null;
+    }
+
+    private void DeliverDecodedVitals(VitalSignsData vitals)
+    {
+        Feed feed = decodingFeed;
+        decodingFeed = null;
+        if (feed == null)
+            return;
+
+        // latestVitals no longer matches the binary base the server knows about
+        feed.binarySequence = 0;
+        feed.etag = null;
+        feed.nextDue = Mathf.Max(feed.nextDue, Time.time + feed.interval);
+        Deliver(feed, null, true);
+    }
+
+    /// <summary>
+    /// Hand one response to every subscriber of the feed. hasVitals means feed.latestVitals was just updated.
+    /// </summary>
+    private void Deliver(Feed feed, string text, bool hasVitals)
+    {
+        if (text != null)
+            feed.latestText = text;
+
+        VitalSignsData vitals = hasVitals ? feed.latestVitals : null;
+
+        // Walk backwards so a subscriber can unsubscribe from inside its callback
+        for (int i = feed.subscribers.Count - 1; i >= 0; i--)
+        {
+            if (i >= feed.subscribers.Count)
+                continue;
+
+            Subscriber subscriber = feed.subscribers[i];
+            if (subscriber.onVitals != null && vitals != null)
+                subscriber.onVitals(vitals);
+            if (subscriber.onText != null && text != null)
+                subscriber.onText(text);
+        }
+    }
+
+    private void DeliverError(Feed feed, string error)
+    {
+        Debug.LogError($"API request failed for {feed.url}: {error}");
+
+        for (int i = feed.subscribers.Count - 1; i >= 0; i--)
+        {
+            if (i >= feed.subscribers.Count)
+                continue;
+
+            feed.subscribers[i].onError?.Invoke(error);
+        }
+    }
+
+    private bool HasTextSubscribers(Feed feed)
+    {
+        foreach (Subscriber subscriber in feed.subscribers)
+        {
+            if (subscriber.onText != null)
+                return true;
+        }
+        return false;
+    }
+
+    private bool HasVitalsSubscribers(Feed feed)
+    {
+        foreach (Subscriber subscriber in feed.subscribers)
+        {
+            if (subscriber.onVitals != null)
+                return true;
+        }
+        return false;
+    }
+}
@@ -0,0 +1,115 @@
+// VitalsRecorder.cs - Captures a monitor's vitals and ECG into a VitalsRecording for replay
+using UnityEngine;
+using System.IO;
+using System;
+
+/// <summary>
+/// Records what a monitor shows (for example a PhysiologySimulator run or a live session) into a
+/// .vrec file that a VitalsReplaySource can play back identically later.
+/// </summary>
+public class VitalsRecorder : MonoBehaviour
+{
+    [Header("Sources")]
+    public ConfigurableAPIManager apiManager;
+    public MultiLeadECGSource ecgSource; // Optional
+    public MultiLeadECGSystem.Lead lead = MultiLeadECGSystem.Lead.II;
+
+    [Header("Output")]
+    public string outputPath = "Scenarios/recording.vrec"; // Relative paths resolve under Application.persistentDataPath
+    public bool recordOnStart = false;
+    public float ecgBufferSeconds = 2f; // ECG held between Updates; covers frame hitches without losing samples
+
+    private VitalsRecordingWriter writer;
+    private WaveformRingBuffer ecgRing;
+    private float[] ecgScratch;
+    private float startTime;
+
+    public bool IsRecording => writer != null;
+
+    private void Start()
+    {
+        if (recordOnStart)
+            StartRecording();
+    }
+
+    private void OnDestroy()
+    {
+        StopRecording();
+    }
+
+    public void StartRecording()
+    {
+        if (writer != null)
+            return;
+
+        if (apiManager == null)
+        {
+            Debug.LogError("API Manager not assigned to VitalsRecorder!");
+            return;
+        }
+
+        string fullPath = Path.IsPathRooted(outputPath) ? outputPath : Path.Combine(Application.persistentDataPath, outputPath);
+        float ecgRate = ecgSource != null ? ecgSource.SamplesPerSecond : 0f;
+
+        try
+        {
+            writer = new VitalsRecordingWriter(fullPath, DateTimeOffset.UtcNow.ToUnixTimeMilliseconds() / 1000.0, ecgRate);
+        }
+        catch (Exception e)
+        {
+            Debug.LogError($"Could not create vitals recording {fullPath}: {e.Message}");
+            return;
+        }
+
+        startTime = Time.time;
+        apiManager.OnVitalSignsUpdated.AddListener(OnVitalSignsUpdated);
+
+        if (ecgSource != null)
+        {
+            ecgRing = new WaveformRingBuffer(Mathf.CeilToInt(ecgRate * Mathf.Max(0.1f, ecgBufferSeconds)));
+            ecgScratch = new float[ecgRing.Capacity];
+            ecgSource.AddConsumer(lead, ecgRing);
+        }
+
+        Debug.Log($"Recording vitals to {fullPath}");
+    }
+
+    public void StopRecording()
+    {
+        if (writer == null)
+            return;
+
+        if (apiManager != null)
+            apiManager.OnVitalSignsUpdated.RemoveListener(OnVitalSignsUpdated);
+
+        if (ecgRing != null)
+        {
+            DrainEcg();
+            if (ecgSource != null)
+                ecgSource.RemoveConsumer(lead, ecgRing);
+            ecgRing = null;
+        }
+
+        Debug.Log($"Recorded {writer.VitalsCount} vitals records and {writer.EcgSampleCount} ECG samples");
+        writer.Dispose();
+        writer = null;
+    }
+
+    private void Update()
+    {
+        if (writer != null && ecgRing != null)
+            DrainEcg();
+    }
+
+    private void OnVitalSignsUpdated(VitalSignsData vitalSigns)
+    {
+        writer?.AddVitals(Time.time - startTime, vitalSigns);
+    }
+
+    private void DrainEcg()
+    {
+        int count;
+        while ((count = ecgRing.Read(ecgScratch, 0, ecgScratch.Length)) > 0)
+            writer.AddEcg(ecgScratch, 0, count);
+    }
+}
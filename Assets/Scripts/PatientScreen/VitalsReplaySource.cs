@@ -0,0 +1,196 @@
+// VitalsReplaySource.cs - Plays a recorded patient trajectory into the usual vitals and ECG consumers
+using UnityEngine;
+using UnityEngine.Events;
+using System.Collections.Generic;
+using System.IO;
+using System;
+
+/// <summary>
+/// Replays a VitalsRecording at 1x or faster, so every trainee sees the identical patient.
+/// Vitals go out through OnVitalSignsUpdated (assign it as a ConfigurableAPIManager's replaySource
+/// and all monitor displays follow), ECG samples into any WaveformRingBuffer consumers.
+/// The file is memory-mapped, so opening is instant regardless of length and Seek jumps anywhere.
+/// </summary>
+public class VitalsReplaySource : MonoBehaviour
+{
+    [Header("Recording")]
+    public string recordingPath = "Scenarios/exam_case.vrec"; // Relative paths resolve under Application.persistentDataPath
+    public bool playOnStart = true;
+    public bool loop = false;
+    public float speed = 1f;
+
+    [Header("Events")]
+    public UnityEvent<VitalSignsData> OnVitalSignsUpdated;
+    public UnityEvent OnFinished;
+
+    private VitalsRecording recording;
+    private readonly VitalSignsData vitals = new VitalSignsData { bloodPressure = new BloodPressure(), deviceStatus = "replay" };
+    private readonly List<WaveformRingBuffer> ecgConsumers = new List<WaveformRingBuffer>();
+    private float[] ecgScratch = new float[256];
+    private double position = 0;     // Seconds since the recording start
+    private int publishedIndex = -1; // Last vitals record sent
+    private long ecgPosition = 0;    // Next ECG sample to send
+    private double clockOffset = 0;  // Added to record times so published timestamps keep going forward
+    private long lastPublishedMs = long.MinValue;
+    private bool playing = false;
+
+    public bool IsPlaying => playing;
+    public bool IsLoaded => recording != null;
+    public double Position => position;
+    public double Duration => recording != null ? recording.Duration : 0;
+    public float EcgSampleRate => recording != null ? recording.EcgSampleRate : 0f;
+
+    private void Awake()
+    {
+        Load(recordingPath);
+    }
+
+    private void Start()
+    {
+        if (playOnStart && recording != null)
+            Play();
+    }
+
+    private void OnDestroy()
+    {
+        recording?.Dispose();
+        recording = null;
+    }
+
+    /// <summary>
+    /// Map a recording, replacing the current one; playback restarts from the beginning
+    /// </summary>
+    public bool Load(string path)
+    {
+        recording?.Dispose();
+        recording = null;
+        playing = false;
+
+        if (string.IsNullOrEmpty(path))
+            return false;
+
+        string fullPath = Path.IsPathRooted(path) ? path : Path.Combine(Application.persistentDataPath, path);
+        recording = VitalsRecording.Open(fullPath, out string error);
+        if (recording == null)
+        {
+            Debug.LogError($"Could not open vitals recording {fullPath}: {error}");
+            return false;
+        }
+
+        recordingPath = path;
+        Seek(0);
+        return true;
+    }
+
+    public void Play() => playing = recording != null;
+    public void Pause() => playing = false;
+
+    /// <summary>
+    /// Jump to seconds since the recording start. The vitals in effect at that moment are sent
+    /// straight away; ECG continues from the new position. Published timestamps carry on from
+    /// where they were, so downstream buffers see time continue rather than jump.
+    /// </summary>
+    public void Seek(double seconds)
+    {
+        if (recording == null)
+            return;
+
+        double target = Math.Max(0, Math.Min(seconds, recording.Duration));
+        clockOffset += position - target;
+        position = target;
+        ecgPosition = (long)(position * recording.EcgSampleRate);
+        publishedIndex = -1;
+
+        foreach (WaveformRingBuffer ring in ecgConsumers)
+            ring.Clear();
+
+        int index = recording.IndexAt(position);
+        if (index >= 0)
+            Publish(index);
+    }
+
+    public void AddEcgConsumer(WaveformRingBuffer ring)
+    {
+        if (ring != null && !ecgConsumers.Contains(ring))
+            ecgConsumers.Add(ring);
+    }
+
+    public void RemoveEcgConsumer(WaveformRingBuffer ring)
+    {
+        ecgConsumers.Remove(ring);
+    }
+
+    private void Update()
+    {
+        if (!playing || recording == null)
+            return;
+
+        position += Time.deltaTime * speed;
+
+        // At high speed several records may pass in one frame; only the latest is shown
+        int index = recording.IndexAt(position);
+        if (index > publishedIndex)
+            Publish(index);
+
+        StreamEcg();
+
+        if (position >= recording.Duration)
+        {
+            if (loop)
+            {
+                Seek(0);
+            }
+            else
+            {
+                playing = false;
+                OnFinished?.Invoke();
+            }
+        }
+    }
+
+    private void Publish(int index)
+    {
+        publishedIndex = index;
+        recording.ReadVitals(index, vitals);
+
+        // Timestamps follow playback time: the recording's own, shifted by every seek and loop so far
+        long ms = (long)((recording.StartTime + clockOffset + recording.RecordTime(index)) * 1000.0);
+        if (ms <= lastPublishedMs)
+        {
+            // Seeking back to a record older than the seek target can still land behind the last one sent
+            clockOffset += (lastPublishedMs + 1 - ms) / 1000.0;
+            ms = lastPublishedMs + 1;
+        }
+        lastPublishedMs = ms;
+        vitals.timestamp = DateTimeOffset.FromUnixTimeMilliseconds(ms).UtcDateTime.ToString("o");
+
+        OnVitalSignsUpdated?.Invoke(vitals);
+    }
+
+    private void StreamEcg()
+    {
+        if (ecgConsumers.Count == 0 || recording.EcgSampleCount == 0)
+            return;
+
+        long target = Math.Min((long)(position * recording.EcgSampleRate), recording.EcgSampleCount);
+
+        // When replaying faster than the consumers drain, skip to what still fits in their buffers
+        int room = int.MaxValue;
+        foreach (WaveformRingBuffer ring in ecgConsumers)
+            room = Mathf.Min(room, ring.Capacity - ring.Count);
+        if (target - ecgPosition > room)
+            ecgPosition = target - room;
+
+        while (ecgPosition < target)
+        {
+            int count = (int)Math.Min(ecgScratch.Length, target - ecgPosition);
+            count = recording.ReadEcg(ecgPosition, ecgScratch, 0, count);
+            if (count == 0)
+                break;
+
+            foreach (WaveformRingBuffer ring in ecgConsumers)
+                ring.Write(ecgScratch, 0, count);
+            ecgPosition += count;
+        }
+    }
+}
@@ -0,0 +1,141 @@
+// VitalsStreamHandler.cs - Incremental Server-Sent Events parser for a long-lived UnityWebRequest
+using UnityEngine.Networking;
+using System;
+
+/// <summary>
+/// Download handler that hands each Server-Sent Event to a callback as soon as its bytes arrive,
+/// instead of waiting for the response to complete (which a stream never does).
+/// Only the "id" and "data" fields are used; comments and other fields are ignored.
+/// Event data is handed over as raw bytes, valid only during the callback.
+/// </summary>
+public class VitalsStreamHandler : DownloadHandlerScript
+{
+    /// <summary>
+    /// id is the numeric event id, or -1 if the event had none
+    /// </summary>
+    public delegate void StreamEvent(long id, ReadOnlySpan<byte> data);
+
+    private const int MaxEventBytes = 64 * 1024;
+
+    private readonly StreamEvent onEvent;
+    private readonly byte[] lineBuffer = new byte[16 * 1024];
+    private byte[] data = new byte[4096];
+    private int lineLength = 0;
+    private int dataLength = 0;
+    private bool hasData = false;
+    private long eventId = -1;
+
+    public long BytesReceived { get; private set; }
+    public int EventsReceived { get; private set; }
+
+    public VitalsStreamHandler(StreamEvent onEvent) : base(new byte[4096])
+    {
+        this.onEvent = onEvent;
+    }
+
+    protected override bool ReceiveData(byte[] chunk, int length)
+    {
+        if (chunk == null || length <= 0)
+            return true;
+
+        BytesReceived += length;
+
+        for (int i = 0; i < length; i++)
+        {
+            byte b = chunk[i];
+            if (b == (byte)'\n')
+            {
+                ProcessLine();
+                lineLength = 0;
+            }
+            else if (b != (byte)'\r')
+            {
+                // An oversized line is malformed; drop its tail rather than grow without bound
+                if (lineLength < lineBuffer.Length)
+                    lineBuffer[lineLength++] = b;
+            }
+        }
+        return true;
+    }
+
+    private void ProcessLine()
+    {
+        // Blank line: dispatch the event assembled so far
+        if (lineLength == 0)
+        {
+            if (hasData)
+            {
+                EventsReceived++;
+                onEvent?.Invoke(eventId, new ReadOnlySpan<byte>(data, 0, dataLength));
+            }
+            dataLength = 0;
+            hasData = false;
+            eventId = -1;
+            return;
+        }
+
+        if (StartsWith("data:"))
+        {
+            // Multi-line data is joined with newlines
+            if (hasData)
+                AppendData((byte)'\n');
+            hasData = true;
+
+            for (int i = ValueStart(5); i < lineLength; i++)
+                AppendData(lineBuffer[i]);
+        }
+        else if (StartsWith("id:"))
+        {
+            eventId = ParseId(ValueStart(3));
+        }
+    }
+
+    private void AppendData(byte b)
+    {
+        if (dataLength == data.Length)
+        {
+            // Bytes past the cap are dropped; the truncated event then fails to decode
+            if (data.Length >= MaxEventBytes)
+                return;
+            Array.Resize(ref data, data.Length * 2);
+        }
+        data[dataLength++] = b;
+    }
+
+    private long ParseId(int start)
+    {
+        if (start >= lineLength)
+            return -1;
+
+        long id = 0;
+        for (int i = start; i < lineLength; i++)
+        {
+            byte b = lineBuffer[i];
+            if (b < (byte)'0' || b > (byte)'9' || id > long.MaxValue / 10)
+                return -1;
+            id = id * 10 + (b - (byte)'0');
+        }
+        return id;
+    }
+
+    private bool StartsWith(string field)
+    {
+        if (lineLength < field.Length)
+            return false;
+
+        for (int i = 0; i < field.Length; i++)
+        {
+            if (lineBuffer[i] != field[i])
+                return false;
+        }
+        return true;
+    }
+
+    private int ValueStart(int start)
+    {
+        // A single space after the colon is part of the syntax, not the value
+        if (start < lineLength && lineBuffer[start] == (byte)' ')
+            start++;
+        return start;
+    }
+}
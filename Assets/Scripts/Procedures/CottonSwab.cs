@@ -4,11 +4,21 @@ public class CottonSwab : MonoBehaviour
 {
     public bool isSoaked = false;
 
+    private int soakedOverride = -1; // RendererOverrideSystem handle, so the material isn't copied
+
     public void SetSoaked()
     {
         isSoaked = true;
 
         // Optional: Visual cue when soaked
-        GetComponent<Renderer>().material.color = Color.cyan;
+        if (soakedOverride < 0)
+            soakedOverride = RendererOverrideSystem.Instance.Register(GetComponent<Renderer>());
+        RendererOverrideSystem.Instance.SetHighlight(soakedOverride, Color.cyan, 1f);
+    }
+
+    private void OnDestroy()
+    {
+        if (RendererOverrideSystem.HasInstance)
+            RendererOverrideSystem.Instance.Unregister(soakedOverride);
     }
 }
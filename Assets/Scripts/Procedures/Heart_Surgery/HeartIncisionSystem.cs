@@ -66,6 +66,21 @@ public class HeartIncisionSystem : MonoBehaviour
     private Material videoMaterial;
     private RenderTexture transitionTexture;
     private Camera transitionCamera;
+    private static readonly WaitForEndOfFrame endOfFrame = new WaitForEndOfFrame();
+
+    // State read by the cached tween callbacks
+    private Material incisionMaterial;
+    private RenderTexture incisionFromTexture;
+    private RenderTexture incisionToTexture;
+    private System.Action<float> setIncisionProgress;
+    private VideoDisplaySettings displayTarget;
+    private Vector3 displayStartPosition;
+    private Vector3 displayStartRotation;
+    private Vector3 displayStartScale;
+    private Color displayStartColor;
+    private Vector2 displayStartUVOffset;
+    private Vector2 displayStartUVTiling;
+    private System.Action<float> setDisplayProgress;
 
     // Store original transform values for InteriorVisual
     private Vector3 originalInteriorPosition;
@@ -74,6 +89,8 @@ public class HeartIncisionSystem : MonoBehaviour
 
     void Start()
     {
+        setIncisionProgress = SetIncisionProgress;
+        setDisplayProgress = SetDisplayProgress;
         InitializeSystem();
         SetupSkinLayer();
         SetupInitialVisibility();
@@ -133,6 +150,8 @@ public class HeartIncisionSystem : MonoBehaviour
 
     void SetupSkinLayer()
     {
+        SetupToolContacts();
+
         if (skinLayer != null)
         {
             // Check if the skin layer has a collider (user should add this manually)
@@ -165,6 +184,41 @@ public class HeartIncisionSystem : MonoBehaviour
         }
     }
 
+    /// <summary>
+    /// Give scalpels a swept tip and this object a contact volume, so quick cuts register
+    /// even when the blade crosses the tissue between two physics steps
+    /// </summary>
+    void SetupToolContacts()
+    {
+        try
+        {
+            foreach (GameObject scalpel in GameObject.FindGameObjectsWithTag(scalpelTag))
+            {
+                if (scalpel.GetComponent<ToolTip>() == null)
+                {
+                    ToolTip.AddTo(scalpel);
+                }
+            }
+        }
+        catch (UnityException e)
+        {
+            Debug.LogWarning($"Could not look up scalpels by tag '{scalpelTag}': {e.Message}");
+        }
+
+        Collider ownCollider = GetComponent<Collider>();
+        if (ownCollider != null)
+        {
+            ContactVolume volume = GetComponent<ContactVolume>();
+            if (volume == null)
+            {
+                volume = gameObject.AddComponent<ContactVolume>();
+                volume.FitTo(ownCollider);
+            }
+            volume.acceptedTag = scalpelTag;
+            volume.OnTipEntered.AddListener(contact => HandleToolEntered(contact.tip.gameObject));
+        }
+    }
+
     void DebugSetup()
     {
         Debug.Log($"HeartIncisionSystem attached to: {gameObject.name}");
@@ -278,7 +332,7 @@ public class HeartIncisionSystem : MonoBehaviour
         }
 
         // Wait for the specified delay
-        yield return new WaitForSeconds(skinLayerRemovalDelay);
+        yield return TweenSystem.Instance.WaitSeconds(skinLayerRemovalDelay);
 
         // Swap visibility: disable skin layer, enable interior visual
         yield return StartCoroutine(SwapSkinLayerAndInterior());
@@ -342,11 +396,16 @@ public class HeartIncisionSystem : MonoBehaviour
         Debug.Log("=== SWAP PROCESS COMPLETE ===");
 
         // Optional: Add a small delay for the transition effect
-        yield return new WaitForSeconds(0.1f);
+        yield return TweenSystem.Instance.WaitSeconds(0.1f);
     }
 
     // Regular trigger detection for deeper incisions (after skin layer is removed)
     void OnTriggerEnter(Collider other)
+    {
+        HandleToolEntered(other.gameObject);
+    }
+
+    void HandleToolEntered(GameObject other)
     {
         // Debug logging to help troubleshoot
         Debug.Log($"Main trigger entered by: {other.name} with tag: {other.tag}");
@@ -425,7 +484,7 @@ public class HeartIncisionSystem : MonoBehaviour
         tempVideoPlayer.targetTexture = targetTexture;
 
         // Wait a frame for video players to initialize
-        yield return new WaitForEndOfFrame();
+        yield return endOfFrame;
 
         // Perform incision transition (center-outward cut effect)
         yield return StartCoroutine(PerformIncisionTransition(currentTexture, targetTexture));
@@ -473,30 +532,11 @@ public class HeartIncisionSystem : MonoBehaviour
             transitionMaterial = new Material(Shader.Find("Unlit/Texture"));
         }
 
-        float elapsedTime = 0f;
-
-        while (elapsedTime < transitionDuration)
-        {
-            float progress = elapsedTime / transitionDuration;
-            float curvedProgress = transitionCurve.Evaluate(progress);
-
-            // Set the transition progress (0 = all from texture, 1 = all to texture)
-            if (transitionMaterial.HasProperty("_Progress"))
-            {
-                transitionMaterial.SetFloat("_Progress", curvedProgress);
-                Graphics.Blit(null, transitionTexture, transitionMaterial);
-            }
-            else
-            {
-                // Simple blend fallback
-                Graphics.Blit(curvedProgress < 0.5f ? fromTexture : toTexture, transitionTexture);
-            }
-
-            videoMaterial.mainTexture = transitionTexture;
+        incisionMaterial = transitionMaterial;
+        incisionFromTexture = fromTexture;
+        incisionToTexture = toTexture;
 
-            elapsedTime += Time.deltaTime;
-            yield return null;
-        }
+        yield return TweenSystem.Instance.Wait(TweenSystem.Instance.Value(0f, 1f, transitionDuration, setIncisionProgress, transitionCurve));
 
         // Ensure final state
         if (transitionMaterial.HasProperty("_Progress"))
@@ -509,9 +549,32 @@ public class HeartIncisionSystem : MonoBehaviour
             Graphics.Blit(toTexture, transitionTexture);
         }
 
+        incisionMaterial = null;
+        incisionFromTexture = null;
+        incisionToTexture = null;
         Destroy(transitionMaterial);
     }
 
+    void SetIncisionProgress(float curvedProgress)
+    {
+        if (incisionMaterial == null)
+            return;
+
+        // Set the transition progress (0 = all from texture, 1 = all to texture)
+        if (incisionMaterial.HasProperty("_Progress"))
+        {
+            incisionMaterial.SetFloat("_Progress", curvedProgress);
+            Graphics.Blit(null, transitionTexture, incisionMaterial);
+        }
+        else
+        {
+            // Simple blend fallback
+            Graphics.Blit(curvedProgress < 0.5f ? incisionFromTexture : incisionToTexture, transitionTexture);
+        }
+
+        videoMaterial.mainTexture = transitionTexture;
+    }
+
     void OnDestroy()
     {
         if (transitionTexture != null)
@@ -558,41 +621,41 @@ public class HeartIncisionSystem : MonoBehaviour
         if (interiorVisualObject == null) yield break;
 
         // Store current settings
-        Vector3 startPosition = interiorVisualObject.localPosition;
-        Vector3 startRotation = interiorVisualObject.localEulerAngles;
-        Vector3 startScale = interiorVisualObject.localScale;
+        displayTarget = targetSettings;
+        displayStartPosition = interiorVisualObject.localPosition;
+        displayStartRotation = interiorVisualObject.localEulerAngles;
+        displayStartScale = interiorVisualObject.localScale;
 
-        Color startColor = videoMaterial != null ? videoMaterial.color : Color.white;
-        Vector2 startUVOffset = videoMaterial != null ? videoMaterial.mainTextureOffset : Vector2.zero;
-        Vector2 startUVTiling = videoMaterial != null ? videoMaterial.mainTextureScale : Vector2.one;
+        displayStartColor = videoMaterial != null ? videoMaterial.color : Color.white;
+        displayStartUVOffset = videoMaterial != null ? videoMaterial.mainTextureOffset : Vector2.zero;
+        displayStartUVTiling = videoMaterial != null ? videoMaterial.mainTextureScale : Vector2.one;
 
-        float elapsedTime = 0f;
+        yield return TweenSystem.Instance.Wait(TweenSystem.Instance.Value(0f, 1f, targetSettings.animationDuration, setDisplayProgress, targetSettings.animationCurve));
 
-        while (elapsedTime < targetSettings.animationDuration)
-        {
-            float progress = elapsedTime / targetSettings.animationDuration;
-            float curvedProgress = targetSettings.animationCurve.Evaluate(progress);
+        // Ensure final values
+        displayTarget = null;
+        ApplyDisplaySettings(targetSettings);
+    }
 
-            // Animate transform
-            interiorVisualObject.localPosition = Vector3.Lerp(startPosition, targetSettings.position, curvedProgress);
-            interiorVisualObject.localEulerAngles = Vector3.Lerp(startRotation, targetSettings.rotation, curvedProgress);
-            interiorVisualObject.localScale = Vector3.Lerp(startScale, targetSettings.scale, curvedProgress);
+    void SetDisplayProgress(float curvedProgress)
+    {
+        VideoDisplaySettings targetSettings = displayTarget;
+        if (targetSettings == null || interiorVisualObject == null)
+            return;
 
-            // Animate material properties
-            if (videoMaterial != null)
-            {
-                Color targetColor = new Color(targetSettings.tintColor.r, targetSettings.tintColor.g, targetSettings.tintColor.b, targetSettings.transparency);
-                videoMaterial.color = Color.Lerp(startColor, targetColor, curvedProgress);
-                videoMaterial.mainTextureOffset = Vector2.Lerp(startUVOffset, targetSettings.uvOffset, curvedProgress);
-                videoMaterial.mainTextureScale = Vector2.Lerp(startUVTiling, targetSettings.uvTiling, curvedProgress);
-            }
+        // Animate transform
+        interiorVisualObject.localPosition = Vector3.Lerp(displayStartPosition, targetSettings.position, curvedProgress);
+        interiorVisualObject.localEulerAngles = Vector3.Lerp(displayStartRotation, targetSettings.rotation, curvedProgress);
+        interiorVisualObject.localScale = Vector3.Lerp(displayStartScale, targetSettings.scale, curvedProgress);
 
-            elapsedTime += Time.deltaTime;
-            yield return null;
+        // Animate material properties
+        if (videoMaterial != null)
+        {
+            Color targetColor = new Color(targetSettings.tintColor.r, targetSettings.tintColor.g, targetSettings.tintColor.b, targetSettings.transparency);
+            videoMaterial.color = Color.Lerp(displayStartColor, targetColor, curvedProgress);
+            videoMaterial.mainTextureOffset = Vector2.Lerp(displayStartUVOffset, targetSettings.uvOffset, curvedProgress);
+            videoMaterial.mainTextureScale = Vector2.Lerp(displayStartUVTiling, targetSettings.uvTiling, curvedProgress);
         }
-
-        // Ensure final values
-        ApplyDisplaySettings(targetSettings);
     }
 
     // Public method to reset the system
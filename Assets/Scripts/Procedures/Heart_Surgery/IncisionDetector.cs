@@ -8,9 +8,30 @@ public class IncisionDetector : MonoBehaviour
     public GameObject retractorSpawnPointRight;
     private bool cutMade = false;
 
+    private void Start()
+    {
+        // Swept contact as well as the trigger, so a fast stroke through the incision line counts
+        ContactVolume volume = GetComponent<ContactVolume>();
+        if (volume == null)
+        {
+            volume = gameObject.AddComponent<ContactVolume>();
+            volume.FitTo(GetComponent<Collider>());
+        }
+        if (scalpel != null && scalpel.GetComponent<ToolTip>() == null)
+        {
+            ToolTip.AddTo(scalpel);
+        }
+        volume.OnTipEntered.AddListener(contact => TryCut(contact.tip.gameObject));
+    }
+
     private void OnTriggerStay(Collider other)
     {
-        if (!cutMade && other.gameObject == scalpel)
+        TryCut(other.gameObject);
+    }
+
+    private void TryCut(GameObject other)
+    {
+        if (!cutMade && other == scalpel)
         {
             // Optionally check scalpel movement distance or time
             cutMade = true;
@@ -6,6 +6,7 @@ using UnityEngine;
 public class SkinLayerTrigger : MonoBehaviour
 {
     private HeartIncisionSystem incisionSystem;
+    private ContactVolume contactVolume;
 
     [Header("Debug Settings")]
     public bool enableDebugLogs = true;
@@ -18,6 +19,17 @@ public class SkinLayerTrigger : MonoBehaviour
     {
         incisionSystem = system;
 
+        // Swept tip contact catches a fast cut that passes through the layer between physics steps
+        contactVolume = GetComponent<ContactVolume>();
+        if (contactVolume == null)
+        {
+            contactVolume = gameObject.AddComponent<ContactVolume>();
+            contactVolume.FitTo(GetComponent<Collider>());
+        }
+        contactVolume.acceptedTag = system.scalpelTag;
+        contactVolume.OnTipEntered.RemoveListener(OnTipEntered);
+        contactVolume.OnTipEntered.AddListener(OnTipEntered);
+
         if (enableDebugLogs)
         {
             Debug.Log($"SkinLayerTrigger initialized on {gameObject.name}");
@@ -25,6 +37,16 @@ public class SkinLayerTrigger : MonoBehaviour
     }
 
     void OnTriggerEnter(Collider other)
+    {
+        HandleToolEntered(other.gameObject);
+    }
+
+    void OnTipEntered(ToolTipContact contact)
+    {
+        HandleToolEntered(contact.tip.gameObject);
+    }
+
+    void HandleToolEntered(GameObject other)
     {
         if (enableDebugLogs)
         {
@@ -24,14 +24,19 @@ public class BloodCleaningSystem : MonoBehaviour
         Final
     }
 
+    private static readonly WaitForEndOfFrame endOfFrame = new WaitForEndOfFrame();
+
     private CleaningState currentState = CleaningState.BloodFlowing;
     private bool isTransitioning = false;
     private Material videoMaterial;
     private RenderTexture transitionTexture;
     private Camera transitionCamera;
+    private Material transitionMaterial;
+    private System.Action<float> setTransitionProgress;
 
     void Start()
     {
+        setTransitionProgress = SetTransitionProgress;
         InitializeSystem();
     }
 
@@ -119,7 +124,7 @@ public class BloodCleaningSystem : MonoBehaviour
         tempVideoPlayer.targetTexture = targetTexture;
 
         // Wait a frame for video players to initialize
-        yield return new WaitForEndOfFrame();
+        yield return endOfFrame;
 
         // Perform top-to-bottom transition
         yield return StartCoroutine(PerformTopToBottomTransition(currentTexture, targetTexture));
@@ -140,33 +145,30 @@ public class BloodCleaningSystem : MonoBehaviour
     IEnumerator PerformTopToBottomTransition(RenderTexture fromTexture, RenderTexture toTexture)
     {
         // Create a material for the transition effect
-        Material transitionMaterial = new Material(Shader.Find("Custom/TopToBottomTransition"));
+        transitionMaterial = new Material(Shader.Find("Custom/TopToBottomTransition"));
         transitionMaterial.SetTexture("_FromTex", fromTexture);
         transitionMaterial.SetTexture("_ToTex", toTexture);
 
-        float elapsedTime = 0f;
+        yield return TweenSystem.Instance.Wait(TweenSystem.Instance.Value(0f, 1f, transitionDuration, setTransitionProgress, transitionCurve));
 
-        while (elapsedTime < transitionDuration)
-        {
-            float progress = elapsedTime / transitionDuration;
-            float curvedProgress = transitionCurve.Evaluate(progress);
+        // Ensure final state
+        SetTransitionProgress(1f);
 
-            // Set the transition progress (0 = all from texture, 1 = all to texture)
-            transitionMaterial.SetFloat("_Progress", curvedProgress);
+        Destroy(transitionMaterial);
+        transitionMaterial = null;
+    }
 
-            // Render the transition
-            Graphics.Blit(null, transitionTexture, transitionMaterial);
-            videoMaterial.mainTexture = transitionTexture;
+    void SetTransitionProgress(float progress)
+    {
+        if (transitionMaterial == null)
+            return;
 
-            elapsedTime += Time.deltaTime;
-            yield return null;
-        }
+        // Set the transition progress (0 = all from texture, 1 = all to texture)
+        transitionMaterial.SetFloat("_Progress", progress);
 
-        // Ensure final state
-        transitionMaterial.SetFloat("_Progress", 1f);
+        // Render the transition
         Graphics.Blit(null, transitionTexture, transitionMaterial);
-
-        Destroy(transitionMaterial);
+        videoMaterial.mainTexture = transitionTexture;
     }
 
     // Alternative simpler approach using UV offset animation
@@ -192,23 +194,13 @@ public class BloodCleaningSystem : MonoBehaviour
         videoPlayer.clip = targetVideo;
 
         // Animate the wipe from top to bottom
-        float elapsedTime = 0f;
         Vector3 startScale = new Vector3(1, 0, 1);
         Vector3 endScale = Vector3.one;
         Vector3 startPosition = new Vector3(0, 0.5f, -0.01f);
         Vector3 endPosition = new Vector3(0, 0, -0.01f);
 
-        while (elapsedTime < transitionDuration)
-        {
-            float progress = elapsedTime / transitionDuration;
-            float curvedProgress = transitionCurve.Evaluate(progress);
-
-            wipeQuad.transform.localScale = Vector3.Lerp(startScale, endScale, curvedProgress);
-            wipeQuad.transform.localPosition = Vector3.Lerp(startPosition, endPosition, curvedProgress);
-
-            elapsedTime += Time.deltaTime;
-            yield return null;
-        }
+        TweenSystem.Instance.ScaleLocal(wipeQuad.transform, startScale, endScale, transitionDuration, transitionCurve);
+        yield return TweenSystem.Instance.Wait(TweenSystem.Instance.MoveLocal(wipeQuad.transform, startPosition, endPosition, transitionDuration, transitionCurve));
 
         // Cleanup
         Destroy(wipeQuad);
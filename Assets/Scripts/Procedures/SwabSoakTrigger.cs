@@ -5,7 +5,38 @@ public class SwabSoakTrigger : MonoBehaviour
     public InjectionProcedureManager procedureManager;
     private bool soaked = false;
 
+    private void Start()
+    {
+        // The swab's tip is swept against vial volumes, so a quick dip isn't missed
+        ToolTip tip = GetComponent<ToolTip>();
+        if (tip == null)
+        {
+            tip = ToolTip.AddTo(gameObject);
+        }
+        tip.OnVolumeEntered.AddListener(contact => HandleContact(contact.volume.gameObject));
+
+        try
+        {
+            foreach (GameObject vial in GameObject.FindGameObjectsWithTag("AntisepticVial"))
+            {
+                if (vial.GetComponent<ContactVolume>() == null)
+                {
+                    vial.AddComponent<ContactVolume>().FitTo(vial.GetComponent<Collider>());
+                }
+            }
+        }
+        catch (UnityException e)
+        {
+            Debug.LogWarning($"Could not look up antiseptic vials: {e.Message}");
+        }
+    }
+
     private void OnTriggerEnter(Collider other)
+    {
+        HandleContact(other.gameObject);
+    }
+
+    private void HandleContact(GameObject other)
     {
         if (soaked) return;
 
@@ -0,0 +1,320 @@
+using UnityEngine;
+using UnityEngine.XR.Interaction.Toolkit;
+using UnityEngine.XR.Interaction.Toolkit.Interactables;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Threading;
+
+namespace Meducator.Progress
+{
+    /// <summary>
+    /// Records how the trainee moved: the head, both hands and every grabbable instrument (needle,
+    /// scalpel, syringe...) while it is held, once per rendered frame, into a PoseRecording file.
+    /// Sampling only copies transforms into a lock-free PoseFrameRing; a background thread drains it
+    /// and does the encoding, compression and disk writes, so the frame pays a few microseconds.
+    /// A grabbable gets its track the first time it is picked up, including ones spawned mid-session.
+    /// At 0.1 mm and 1/32767 steps a 30-minute session is a few MB.
+    /// </summary>
+    public class PoseRecorder : MonoBehaviour
+    {
+        [Header("Tracks")]
+        public Transform head;                        // Defaults to the main camera
+        public Transform leftHand;
+        public Transform rightHand;
+        public Transform[] instruments;               // Recorded whenever active
+        public bool includeGrabInteractables = true;  // Recorded while held, from their first grab
+
+        [Header("Output")]
+        public string outputFolder = "Sessions";      // Relative paths resolve under Application.persistentDataPath
+        public bool recordOnStart = false;
+        public float positionStep = 1e-4f;            // Metres per stored position step
+        public float bufferSeconds = 4f;              // Frames the ring holds if the flush thread falls behind
+        public int flushIntervalMs = 250;
+
+        private readonly List<Transform> tracks = new List<Transform>();
+        private readonly List<XRGrabInteractable> grabs = new List<XRGrabInteractable>(); // Null for always-recorded tracks
+        private readonly List<XRGrabInteractable> watchedGrabs = new List<XRGrabInteractable>();
+        private readonly List<XRInteractionManager> watchedManagers = new List<XRInteractionManager>();
+        private readonly string[] trackNames = new string[PoseRecording.MaxTracks];
+        private int publishedTracks = 0; // Names the flush thread may hand the writer
+        private PoseRecordingWriter writer;
+        private PoseFrameRing ring;
+        private float[] frame;
+        private double startTime;
+        private string fullPath;
+        private int droppedFrames = 0;
+
+        // Flush thread; the thread owns writer until it is joined
+        private Thread flusher;
+        private readonly AutoResetEvent flushRequested = new AutoResetEvent(false);
+        private volatile bool stopping = false;
+        private volatile bool writeFailed = false;
+
+        public bool IsRecording => writer != null;
+        public string OutputPath => fullPath;
+        public int DroppedFrames => droppedFrames;
+
+        private void Start()
+        {
+            if (recordOnStart)
+                StartRecording();
+        }
+
+        private void OnDestroy()
+        {
+            StopRecording();
+        }
+
+        public void StartRecording()
+        {
+            if (writer != null)
+                return;
+
+            CollectTracks();
+            if (tracks.Count == 0)
+            {
+                Debug.LogWarning("PoseRecorder: nothing to record (no head, hands or instruments found)");
+                return;
+            }
+
+            string[] names = new string[tracks.Count];
+            for (int i = 0; i < tracks.Count; i++)
+            {
+                names[i] = tracks[i].name;
+                trackNames[i] = names[i];
+            }
+            publishedTracks = tracks.Count;
+
+            string folder = Path.IsPathRooted(outputFolder) ? outputFolder : Path.Combine(Application.persistentDataPath, outputFolder);
+            fullPath = Path.Combine(folder, $"poses_{DateTime.Now:yyyyMMdd_HHmmss}{PoseRecording.Extension}");
+            float sampleRate = UnityEngine.XR.XRDevice.refreshRate > 0f ? UnityEngine.XR.XRDevice.refreshRate : 90f; // Nominal; frames carry their own times
+
+            try
+            {
+                writer = new PoseRecordingWriter(fullPath, DateTimeOffset.UtcNow.ToUnixTimeMilliseconds() / 1000.0, sampleRate, names, positionStep);
+            }
+            catch (Exception e)
+            {
+                Debug.LogError($"Could not create pose recording {fullPath}: {e.Message}");
+                writer = null;
+                return;
+            }
+
+            // Room for every track that can still be added on a grab
+            int trackCapacity = includeGrabInteractables ? PoseRecording.MaxTracks : tracks.Count;
+            ring = new PoseFrameRing(Mathf.CeilToInt(sampleRate * Mathf.Max(0.5f, bufferSeconds)), trackCapacity);
+            frame = new float[ring.Stride];
+            droppedFrames = 0;
+            writeFailed = false;
+            stopping = false;
+            startTime = Time.realtimeSinceStartupAsDouble;
+
+            flusher = new Thread(FlushLoop) { IsBackground = true, Name = "PoseRecorder" };
+            flusher.Start();
+
+            // Tracked poses are refreshed just before rendering; sample the freshest ones
+            Application.onBeforeRender += Sample;
+
+            if (includeGrabInteractables)
+                WatchGrabInteractables();
+
+            Debug.Log($"Recording {tracks.Count} poses to {fullPath}");
+        }
+
+        public void StopRecording()
+        {
+            if (writer == null)
+                return;
+
+            Application.onBeforeRender -= Sample;
+            UnwatchGrabInteractables();
+
+            stopping = true;
+            flushRequested.Set();
+            flusher?.Join();
+            flusher = null;
+
+            bool complete = !writeFailed;
+            try
+            {
+                writer.Dispose();
+                Debug.Log($"Recorded {writer.FrameCount} pose frames ({new FileInfo(fullPath).Length / 1024} KB, {droppedFrames} dropped)");
+            }
+            catch (Exception e)
+            {
+                Debug.LogError($"Could not finish pose recording {fullPath}: {e.Message}");
+                complete = false;
+            }
+
+            // A recording that stopped partway is not one to score against
+            if (complete && UserProgressManager.Instance != null)
+                UserProgressManager.Instance.SetCustomData("poseRecording", fullPath);
+
+            writer = null;
+            ring = null;
+        }
+
+        private void CollectTracks()
+        {
+            tracks.Clear();
+            grabs.Clear();
+
+            if (head == null && Camera.main != null)
+                head = Camera.main.transform;
+            AddTrack(head, null);
+            AddTrack(leftHand, null);
+            AddTrack(rightHand, null);
+
+            if (instruments != null)
+            {
+                foreach (Transform instrument in instruments)
+                    AddTrack(instrument, null);
+            }
+
+            // Grabbables are added as they are picked up, see WatchGrabInteractables
+        }
+
+        private void WatchGrabInteractables()
+        {
+            foreach (XRInteractionManager manager in FindObjectsOfType<XRInteractionManager>())
+            {
+                manager.interactableRegistered += OnInteractableRegistered;
+                watchedManagers.Add(manager);
+            }
+
+            foreach (XRGrabInteractable grab in FindObjectsOfType<XRGrabInteractable>())
+                WatchGrab(grab);
+        }
+
+        private void UnwatchGrabInteractables()
+        {
+            foreach (XRInteractionManager manager in watchedManagers)
+            {
+                if (manager != null)
+                    manager.interactableRegistered -= OnInteractableRegistered;
+            }
+            watchedManagers.Clear();
+
+            foreach (XRGrabInteractable grab in watchedGrabs)
+            {
+                if (grab != null)
+                    grab.selectEntered.RemoveListener(OnGrabSelected);
+            }
+            watchedGrabs.Clear();
+        }
+
+        private void OnInteractableRegistered(InteractableRegisteredEventArgs args)
+        {
+            if (args.interactableObject is XRGrabInteractable grab)
+                WatchGrab(grab);
+        }
+
+        private void WatchGrab(XRGrabInteractable grab)
+        {
+            if (watchedGrabs.Contains(grab))
+                return;
+
+            grab.selectEntered.AddListener(OnGrabSelected);
+            watchedGrabs.Add(grab);
+            if (grab.isSelected)
+                AddTrack(grab.transform, grab);
+        }
+
+        private void OnGrabSelected(SelectEnterEventArgs args)
+        {
+            if (writer != null && args.interactableObject is XRGrabInteractable grab)
+                AddTrack(grab.transform, grab);
+        }
+
+        private void AddTrack(Transform track, XRGrabInteractable grab)
+        {
+            if (track == null || tracks.Contains(track))
+                return;
+
+            if (tracks.Count == PoseRecording.MaxTracks)
+            {
+                Debug.LogWarning($"PoseRecorder: more than {PoseRecording.MaxTracks} tracks, skipping {track.name}");
+                return;
+            }
+
+            tracks.Add(track);
+            grabs.Add(grab);
+
+            if (writer != null)
+            {
+                // The name is in place before the flush thread can see the track, and before any frame uses it
+                trackNames[tracks.Count - 1] = track.name;
+                Volatile.Write(ref publishedTracks, tracks.Count);
+            }
+        }
+
+        private void Sample()
+        {
+            ulong tracked = 0;
+            for (int i = 0; i < tracks.Count; i++)
+            {
+                Transform track = tracks[i];
+                if (track == null || !track.gameObject.activeInHierarchy)
+                    continue;
+
+                XRGrabInteractable grab = grabs[i];
+                if (grab != null && !grab.isSelected)
+                    continue;
+
+                track.GetPositionAndRotation(out Vector3 position, out Quaternion rotation);
+                int p = i * PoseRecording.FloatsPerPose;
+                frame[p] = position.x;
+                frame[p + 1] = position.y;
+                frame[p + 2] = position.z;
+                frame[p + 3] = rotation.x;
+                frame[p + 4] = rotation.y;
+                frame[p + 5] = rotation.z;
+                frame[p + 6] = rotation.w;
+                tracked |= 1UL << i;
+            }
+
+            if (!ring.TryWrite(Time.realtimeSinceStartupAsDouble - startTime, tracked, frame))
+            {
+                droppedFrames++;
+                flushRequested.Set();
+            }
+        }
+
+        private void FlushLoop()
+        {
+            while (true)
+            {
+                flushRequested.WaitOne(flushIntervalMs);
+                bool last = stopping;
+
+                if (writeFailed)
+                {
+                    ring.Clear();
+                }
+                else
+                {
+                    try
+                    {
+                        // Tracks published by now cover every frame pending by now
+                        int pending = ring.Count;
+                        int published = Volatile.Read(ref publishedTracks);
+                        while (writer.TrackCount < published)
+                            writer.AddTrack(trackNames[writer.TrackCount]);
+                        ring.ReadInto(writer, pending);
+                    }
+                    catch (Exception e)
+                    {
+                        Debug.LogError($"Pose recording write failed, stopping capture: {e.Message}");
+                        writeFailed = true;
+                        ring.Clear();
+                    }
+                }
+
+                // Frames sampled before stopping was seen were drained above
+                if (last)
+                    return;
+            }
+        }
+    }
+}
@@ -1,4 +1,3 @@
-using System.Collections;
 using UnityEngine;
 using UnityEngine.UI;
 using UnityEngine.SceneManagement;
@@ -47,6 +46,7 @@ namespace Meducator.Selection
         
         private string selectedMode = "";
         private bool isTransitioning = false;
+        private string pendingSceneName;
         
         private void Start()
         {
@@ -58,7 +58,7 @@ namespace Meducator.Selection
 			ApplyEmojiFontIfAvailable(basicCategoryButton);
 			ApplyEmojiFontIfAvailable(advancedCategoryButton);
 			EnsureSurgeryCardIcons();
-            StartCoroutine(FadeInAnimation());
+            FadeInAnimation();
         }
         
         private void InitializeUI()
@@ -163,12 +163,12 @@ namespace Meducator.Selection
             Debug.Log($"Selected Mode: {mode}");
             
             // Transition to surgery selection
-            StartCoroutine(TransitionToSurgerySelection());
+            TransitionToSurgerySelection();
         }
         
-        private IEnumerator TransitionToSurgerySelection()
+        private void TransitionToSurgerySelection()
         {
-            if (isTransitioning) yield break;
+            if (isTransitioning) return;
             isTransitioning = true;
             
             // Fade out mode selection
@@ -178,16 +178,18 @@ namespace Meducator.Selection
                 if (modeCanvasGroup == null)
                     modeCanvasGroup = modeSelectionPanel.AddComponent<CanvasGroup>();
                 
-                float elapsedTime = 0f;
-                while (elapsedTime < transitionDuration)
-                {
-                    modeCanvasGroup.alpha = 1f - (elapsedTime / transitionDuration);
-                    elapsedTime += Time.deltaTime;
-                    yield return null;
-                }
-                
-                modeSelectionPanel.SetActive(false);
+                TweenSystem.Instance.Fade(modeCanvasGroup, 1f, 0f, transitionDuration, null, ShowSurgerySelection);
             }
+            else
+            {
+                ShowSurgerySelection();
+            }
+        }
+        
+        private void ShowSurgerySelection()
+        {
+            if (modeSelectionPanel != null)
+                modeSelectionPanel.SetActive(false);
             
             // Show surgery selection
             if (surgerySelectionPanel != null)
@@ -198,19 +200,16 @@ namespace Meducator.Selection
                 if (surgeryCanvasGroup == null)
                     surgeryCanvasGroup = surgerySelectionPanel.AddComponent<CanvasGroup>();
                 
-                surgeryCanvasGroup.alpha = 0f;
-                
-                float elapsedTime = 0f;
-                while (elapsedTime < transitionDuration)
-                {
-                    surgeryCanvasGroup.alpha = elapsedTime / transitionDuration;
-                    elapsedTime += Time.deltaTime;
-                    yield return null;
-                }
-                
-                surgeryCanvasGroup.alpha = 1f;
+                TweenSystem.Instance.Fade(surgeryCanvasGroup, 0f, 1f, transitionDuration, null, EndTransition);
             }
-            
+            else
+            {
+                EndTransition();
+            }
+        }
+        
+        private void EndTransition()
+        {
             isTransitioning = false;
         }
         
@@ -244,7 +243,7 @@ namespace Meducator.Selection
             // For Suturing, load SampleScene
             if (surgeryName == "Suturing")
             {
-                StartCoroutine(TransitionToScene(sampleSceneName));
+                TransitionToScene(sampleSceneName);
             }
             else
             {
@@ -254,49 +253,28 @@ namespace Meducator.Selection
             }
         }
         
-        private IEnumerator TransitionToScene(string sceneName)
+        private void TransitionToScene(string sceneName)
         {
-            if (isTransitioning) yield break;
+            if (isTransitioning) return;
             isTransitioning = true;
+            pendingSceneName = sceneName;
             
-            // Fade out animation
-            float elapsedTime = 0f;
-            while (elapsedTime < transitionDuration)
-            {
-                if (canvasGroup != null)
-                {
-                    canvasGroup.alpha = 1f - fadeCurve.Evaluate(elapsedTime / transitionDuration);
-                }
-                
-                elapsedTime += Time.deltaTime;
-                yield return null;
-            }
-            
+            // Fade out animation, then load the scene
             if (canvasGroup != null)
-                canvasGroup.alpha = 0f;
-            
-            // Load the scene
-            SceneManager.LoadScene(sceneName);
+                TweenSystem.Instance.Fade(canvasGroup, 1f, 0f, transitionDuration, fadeCurve, LoadPendingScene);
+            else
+                TweenSystem.Instance.Delay(transitionDuration, LoadPendingScene);
         }
         
-        private IEnumerator FadeInAnimation()
+        private void LoadPendingScene()
+        {
+            SceneManager.LoadScene(pendingSceneName);
+        }
+        
+        private void FadeInAnimation()
         {
-            yield return new WaitForSeconds(0.2f);
-            
-            float elapsedTime = 0f;
-            while (elapsedTime < transitionDuration)
-            {
-                if (canvasGroup != null)
-                {
-                    canvasGroup.alpha = fadeCurve.Evaluate(elapsedTime / transitionDuration);
-                }
-                
-                elapsedTime += Time.deltaTime;
-                yield return null;
-            }
-            
             if (canvasGroup != null)
-                canvasGroup.alpha = 1f;
+                TweenSystem.Instance.Fade(canvasGroup, 0f, 1f, transitionDuration, fadeCurve, null, 0.2f);
         }
         
         private void Logout()
@@ -0,0 +1,343 @@
+using UnityEngine;
+using System;
+using System.Collections.Generic;
+
+/// <summary>
+/// Per-renderer colour overrides (tint, alpha, highlight) applied through one shared
+/// MaterialPropertyBlock, so nothing ever touches renderer.material and no material copies are
+/// made. The block is set per material index, so each sub-material keeps its own base colour.
+/// Changes only mark a renderer dirty; all dirty renderers are written in one pass in LateUpdate,
+/// after the TweenSystem has advanced any fades. A renderer back at its defaults has its block
+/// removed, so it returns to the SRP Batcher path and batch counts don't creep up as stitches are
+/// completed.
+/// </summary>
+public class RendererOverrideSystem : MonoBehaviour
+{
+    private struct Entry
+    {
+        public Renderer renderer;
+        public int references;
+        public int[] colorProperties; // Per material index: _BaseColor or _Color, whichever the shader has, or -1
+        public Color[] baseColors;    // Per material index, from the shared materials
+        public Color tint;
+        public float alpha;
+        public Color highlight;
+        public float highlightAmount;
+        public bool dirty;
+        public bool overridden;     // Carries property blocks
+    }
+
+    private sealed class Group
+    {
+        public int[] handles;
+        public Action<float> setAlpha; // Cached so fades allocate nothing
+    }
+
+    private static RendererOverrideSystem instance;
+    private static readonly int BaseColorId = Shader.PropertyToID("_BaseColor");
+    private static readonly int ColorId = Shader.PropertyToID("_Color");
+
+    private Entry[] entries = new Entry[64];
+    private int entryCount = 0;
+    private readonly Stack<int> freeEntries = new Stack<int>();
+    private readonly Dictionary<Renderer, int> handles = new Dictionary<Renderer, int>();
+    private int[] dirty = new int[64];
+    private int dirtyCount = 0;
+    private readonly List<Group> groups = new List<Group>();
+    private readonly Stack<int> freeGroups = new Stack<int>();
+    private MaterialPropertyBlock block;
+
+    public static RendererOverrideSystem Instance
+    {
+        get
+        {
+            if (instance == null)
+            {
+                instance = FindObjectOfType<RendererOverrideSystem>();
+                if (instance == null)
+                {
+                    instance = new GameObject("RendererOverrideSystem").AddComponent<RendererOverrideSystem>();
+                }
+            }
+            return instance;
+        }
+    }
+
+    public static bool HasInstance => instance != null;
+
+    /// <summary>
+    /// Renderers currently carrying a property block
+    /// </summary>
+    public int OverriddenCount { get; private set; }
+
+    private void Awake()
+    {
+        if (instance == null)
+        {
+            instance = this;
+        }
+        else if (instance != this)
+        {
+            Debug.LogWarning("Multiple RendererOverrideSystem instances found. Using the first one.");
+        }
+
+        block = new MaterialPropertyBlock();
+    }
+
+    private void OnDestroy()
+    {
+        if (instance == this)
+        {
+            instance = null;
+        }
+    }
+
+    /// <summary>
+    /// Start overriding a renderer. Registering the same renderer again returns the same handle;
+    /// each Register needs its own Unregister. Returns -1 if none of its shaders has a colour property.
+    /// </summary>
+    public int Register(Renderer renderer)
+    {
+        if (renderer == null)
+            return -1;
+
+        if (handles.TryGetValue(renderer, out int existing))
+        {
+            entries[existing].references++;
+            return existing;
+        }
+
+        Material[] materials = renderer.sharedMaterials;
+        int[] properties = new int[materials.Length];
+        Color[] baseColors = new Color[materials.Length];
+        bool anyProperty = false;
+        for (int i = 0; i < materials.Length; i++)
+        {
+            Material material = materials[i];
+            int property = -1;
+            if (material != null && material.HasProperty(BaseColorId))
+                property = BaseColorId;
+            else if (material != null && material.HasProperty(ColorId))
+                property = ColorId;
+
+            properties[i] = property;
+            if (property >= 0)
+            {
+                baseColors[i] = material.GetColor(property);
+                anyProperty = true;
+            }
+        }
+        if (!anyProperty)
+            return -1;
+
+        int handle;
+        if (freeEntries.Count > 0)
+        {
+            handle = freeEntries.Pop();
+        }
+        else
+        {
+            if (entryCount == entries.Length)
+                Array.Resize(ref entries, entries.Length * 2);
+            handle = entryCount++;
+        }
+
+        entries[handle] = new Entry
+        {
+            renderer = renderer,
+            references = 1,
+            colorProperties = properties,
+            baseColors = baseColors,
+            tint = Color.white,
+            alpha = 1f,
+            highlight = Color.white,
+            highlightAmount = 0f
+        };
+        handles[renderer] = handle;
+        return handle;
+    }
+
+    /// <summary>
+    /// Drop one reference; the last one removes the override from the renderer
+    /// </summary>
+    public void Unregister(int handle)
+    {
+        if (!IsValid(handle) || --entries[handle].references > 0)
+            return;
+
+        Renderer renderer = entries[handle].renderer;
+        if (entries[handle].overridden)
+        {
+            OverriddenCount--;
+            if (renderer != null)
+                ClearBlocks(renderer, entries[handle].colorProperties.Length);
+        }
+        handles.Remove(renderer);
+        entries[handle] = default;
+        freeEntries.Push(handle);
+    }
+
+    /// <summary>
+    /// Multiplies the material's own colour
+    /// </summary>
+    public void SetTint(int handle, Color tint)
+    {
+        if (!IsValid(handle) || entries[handle].tint == tint)
+            return;
+        entries[handle].tint = tint;
+        MarkDirty(handle);
+    }
+
+    public void SetAlpha(int handle, float alpha)
+    {
+        if (!IsValid(handle) || entries[handle].alpha == alpha)
+            return;
+        entries[handle].alpha = alpha;
+        MarkDirty(handle);
+    }
+
+    /// <summary>
+    /// Blends the tinted colour toward a highlight colour (0 = off, 1 = fully highlighted)
+    /// </summary>
+    public void SetHighlight(int handle, Color color, float amount)
+    {
+        if (!IsValid(handle) || (entries[handle].highlight == color && entries[handle].highlightAmount == amount))
+            return;
+        entries[handle].highlight = color;
+        entries[handle].highlightAmount = amount;
+        MarkDirty(handle);
+    }
+
+    /// <summary>
+    /// Register several renderers to fade together (a visualizer and its children).
+    /// Returns the group id for SetGroupAlpha and FadeGroup.
+    /// </summary>
+    public int CreateGroup(Renderer[] renderers)
+    {
+        List<int> members = new List<int>(renderers.Length);
+        foreach (Renderer renderer in renderers)
+        {
+            int handle = Register(renderer);
+            if (handle >= 0)
+                members.Add(handle);
+        }
+
+        Group group = new Group { handles = members.ToArray() };
+        group.setAlpha = alpha => SetAlpha(group, alpha);
+        if (freeGroups.Count > 0)
+        {
+            int id = freeGroups.Pop();
+            groups[id] = group;
+            return id;
+        }
+        groups.Add(group);
+        return groups.Count - 1;
+    }
+
+    public void DestroyGroup(int group)
+    {
+        if (group < 0 || group >= groups.Count || groups[group] == null)
+            return;
+
+        foreach (int handle in groups[group].handles)
+            Unregister(handle);
+        groups[group] = null;
+        freeGroups.Push(group);
+    }
+
+    public void SetGroupAlpha(int group, float alpha)
+    {
+        if (group >= 0 && group < groups.Count && groups[group] != null)
+            SetAlpha(groups[group], alpha);
+    }
+
+    /// <summary>
+    /// Fade every renderer in the group on the TweenSystem. Returns the tween handle.
+    /// </summary>
+    public int FadeGroup(int group, float from, float to, float duration, AnimationCurve curve = null, Action onComplete = null)
+    {
+        if (group < 0 || group >= groups.Count || groups[group] == null)
+        {
+            onComplete?.Invoke();
+            return 0;
+        }
+        return TweenSystem.Instance.Value(from, to, duration, groups[group].setAlpha, curve, onComplete);
+    }
+
+    private void SetAlpha(Group group, float alpha)
+    {
+        foreach (int handle in group.handles)
+            SetAlpha(handle, alpha);
+    }
+
+    private bool IsValid(int handle)
+    {
+        return handle >= 0 && handle < entryCount && entries[handle].references > 0;
+    }
+
+    private void MarkDirty(int handle)
+    {
+        if (entries[handle].dirty)
+            return;
+        entries[handle].dirty = true;
+        if (dirtyCount == dirty.Length)
+            Array.Resize(ref dirty, dirty.Length * 2);
+        dirty[dirtyCount++] = handle;
+    }
+
+    private void LateUpdate()
+    {
+        for (int d = 0; d < dirtyCount; d++)
+        {
+            int handle = dirty[d];
+            ref Entry entry = ref entries[handle];
+            if (!entry.dirty)
+                continue; // Unregistered since it was marked
+            entry.dirty = false;
+
+            Renderer renderer = entry.renderer;
+            if (renderer == null)
+                continue;
+
+            bool atDefaults = entry.tint == Color.white && entry.alpha >= 1f && entry.highlightAmount <= 0f;
+            if (atDefaults)
+            {
+                // Back on the shared materials as-is
+                if (entry.overridden)
+                {
+                    ClearBlocks(renderer, entry.colorProperties.Length);
+                    entry.overridden = false;
+                    OverriddenCount--;
+                }
+                continue;
+            }
+
+            for (int i = 0; i < entry.colorProperties.Length; i++)
+            {
+                if (entry.colorProperties[i] < 0)
+                    continue;
+
+                Color baseColor = entry.baseColors[i];
+                Color color = baseColor * entry.tint;
+                color = Color.Lerp(color, entry.highlight, entry.highlightAmount);
+                color.a = baseColor.a * entry.tint.a * entry.alpha;
+
+                block.Clear();
+                block.SetColor(entry.colorProperties[i], color);
+                renderer.SetPropertyBlock(block, i);
+            }
+            if (!entry.overridden)
+            {
+                entry.overridden = true;
+                OverriddenCount++;
+            }
+        }
+        dirtyCount = 0;
+    }
+
+    private static void ClearBlocks(Renderer renderer, int materialCount)
+    {
+        for (int i = 0; i < materialCount; i++)
+            renderer.SetPropertyBlock(null, i);
+    }
+}
@@ -0,0 +1,400 @@
+using UnityEngine;
+using System;
+using System.Collections.Generic;
+
+/// <summary>
+/// Central scheduler for short property animations (slides, fades, progress values) that used to
+/// run as one coroutine each. Active tweens live in one flat array and advance together in a
+/// single pass per frame; AnimationCurves are sampled once into lookup tables, so evaluating one
+/// is a table lerp. Starting a tween allocates nothing once its curve has been seen; pass cached
+/// delegates for onUpdate and onComplete to keep it that way.
+/// Completion callbacks run after the pass, so they may start or kill tweens freely.
+/// </summary>
+public class TweenSystem : MonoBehaviour
+{
+    public const int CurveSamples = 64; // Segments per lookup table
+
+    private enum Kind : byte { Delay, Value, Position, LocalPosition, LocalScale, Alpha }
+
+    private struct Tween
+    {
+        public int id;
+        public Kind kind;
+        public bool dead;
+        public float startTime;
+        public float inverseDuration;
+        public int curve;       // Offset into curveSamples, -1 for linear
+        public Vector3 from;    // Value and Alpha use x
+        public Vector3 to;
+        public UnityEngine.Object target;
+        public Action<float> onUpdate;
+        public Action onComplete;
+    }
+
+    private sealed class TweenWait : CustomYieldInstruction
+    {
+        public TweenSystem system;
+        public int handle;
+
+        public override bool keepWaiting
+        {
+            get
+            {
+                if (system != null && system.IsActive(handle))
+                    return true;
+                if (system != null)
+                {
+                    system.waits.Push(this);
+                    system = null;
+                }
+                return false;
+            }
+        }
+    }
+
+    private static TweenSystem instance;
+
+    private Tween[] tweens = new Tween[64];
+    private int count = 0;
+
+    // Handles: low 16 bits are the id + 1 (so 0 is never valid), the rest is a generation so stale handles are ignored
+    private int[] denseOf = new int[64];
+    private int[] generations = new int[64];
+    private readonly Stack<int> freeIds = new Stack<int>();
+    private int idCount = 0;
+
+    private float[] curveSamples = new float[(CurveSamples + 1) * 8];
+    private int curveSampleCount = 0;
+    private readonly Dictionary<AnimationCurve, int> curveOffsets = new Dictionary<AnimationCurve, int>();
+
+    private Action[] completed = new Action[16];
+    private int completedCount = 0;
+    private readonly Stack<TweenWait> waits = new Stack<TweenWait>();
+
+    public static TweenSystem Instance
+    {
+        get
+        {
+            if (instance == null)
+            {
+                instance = FindObjectOfType<TweenSystem>();
+                if (instance == null)
+                {
+                    instance = new GameObject("TweenSystem").AddComponent<TweenSystem>();
+                }
+            }
+            return instance;
+        }
+    }
+
+    public static bool HasInstance => instance != null;
+
+    public int ActiveCount => count;
+
+    private void Awake()
+    {
+        if (instance == null)
+        {
+            instance = this;
+        }
+        else if (instance != this)
+        {
+            Debug.LogWarning("Multiple TweenSystem instances found. Using the first one.");
+        }
+    }
+
+    private void OnDestroy()
+    {
+        if (instance == this)
+        {
+            instance = null;
+        }
+    }
+
+    /// <summary>
+    /// Call onComplete after a delay (replaces yield return new WaitForSeconds)
+    /// </summary>
+    public int Delay(float seconds, Action onComplete)
+    {
+        return Add(Kind.Delay, null, Vector3.zero, Vector3.zero, seconds, null, null, onComplete, 0f);
+    }
+
+    /// <summary>
+    /// Animate a number from one value to another through the curve, reporting each frame's value
+    /// </summary>
+    public int Value(float from, float to, float duration, Action<float> onUpdate, AnimationCurve curve = null, Action onComplete = null, float delay = 0f)
+    {
+        return Add(Kind.Value, null, new Vector3(from, 0f, 0f), new Vector3(to, 0f, 0f), duration, curve, onUpdate, onComplete, delay);
+    }
+
+    /// <summary>
+    /// Slide a transform's world position
+    /// </summary>
+    public int Move(Transform target, Vector3 from, Vector3 to, float duration, AnimationCurve curve = null, Action onComplete = null, float delay = 0f)
+    {
+        return Add(Kind.Position, target, from, to, duration, curve, null, onComplete, delay);
+    }
+
+    public int MoveLocal(Transform target, Vector3 from, Vector3 to, float duration, AnimationCurve curve = null, Action onComplete = null, float delay = 0f)
+    {
+        return Add(Kind.LocalPosition, target, from, to, duration, curve, null, onComplete, delay);
+    }
+
+    public int ScaleLocal(Transform target, Vector3 from, Vector3 to, float duration, AnimationCurve curve = null, Action onComplete = null, float delay = 0f)
+    {
+        return Add(Kind.LocalScale, target, from, to, duration, curve, null, onComplete, delay);
+    }
+
+    /// <summary>
+    /// Fade a CanvasGroup's alpha
+    /// </summary>
+    public int Fade(CanvasGroup target, float from, float to, float duration, AnimationCurve curve = null, Action onComplete = null, float delay = 0f)
+    {
+        return Add(Kind.Alpha, target, new Vector3(from, 0f, 0f), new Vector3(to, 0f, 0f), duration, curve, null, onComplete, delay);
+    }
+
+    public bool IsActive(int handle)
+    {
+        int id = (handle & 0xFFFF) - 1;
+        return id >= 0 && id < idCount && (generations[id] & 0x7FFF) == (handle >> 16) && denseOf[id] >= 0;
+    }
+
+    /// <summary>
+    /// Stop a tween where it is, without completing it. Stale handles are ignored.
+    /// </summary>
+    public void Kill(int handle)
+    {
+        if (!IsActive(handle))
+            return;
+
+        int id = (handle & 0xFFFF) - 1;
+        tweens[denseOf[id]].dead = true; // Removed by the next pass
+        ReleaseId(id);
+    }
+
+    /// <summary>
+    /// Yield this from a coroutine to wait for a tween to finish (or be killed).
+    /// Each instance is single use and returns to a pool once it stops waiting.
+    /// </summary>
+    public CustomYieldInstruction Wait(int handle)
+    {
+        TweenWait wait = waits.Count > 0 ? waits.Pop() : new TweenWait();
+        wait.system = this;
+        wait.handle = handle;
+        return wait;
+    }
+
+    /// <summary>
+    /// Pooled replacement for yield return new WaitForSeconds(seconds)
+    /// </summary>
+    public CustomYieldInstruction WaitSeconds(float seconds)
+    {
+        return Wait(Delay(seconds, null));
+    }
+
+    /// <summary>
+    /// Re-sample every curve seen so far (after editing curves in the Inspector at runtime)
+    /// </summary>
+    public void RefreshCurves()
+    {
+        foreach (KeyValuePair<AnimationCurve, int> entry in curveOffsets)
+            SampleCurve(entry.Key, entry.Value);
+    }
+
+    private int Add(Kind kind, UnityEngine.Object target, Vector3 from, Vector3 to, float duration, AnimationCurve curve, Action<float> onUpdate, Action onComplete, float delay)
+    {
+        int id;
+        if (freeIds.Count > 0)
+        {
+            id = freeIds.Pop();
+        }
+        else
+        {
+            if (idCount == 0xFFFE)
+            {
+                Debug.LogError("TweenSystem: too many active tweens");
+                return 0;
+            }
+            if (idCount == denseOf.Length)
+            {
+                Array.Resize(ref denseOf, denseOf.Length * 2);
+                Array.Resize(ref generations, generations.Length * 2);
+            }
+            id = idCount++;
+        }
+
+        if (count == tweens.Length)
+            Array.Resize(ref tweens, tweens.Length * 2);
+
+        int index = count++;
+        denseOf[id] = index;
+        tweens[index] = new Tween
+        {
+            id = id,
+            kind = kind,
+            startTime = Time.time + Mathf.Max(0f, delay),
+            inverseDuration = duration > 0f ? 1f / duration : float.PositiveInfinity,
+            curve = CurveOffset(curve),
+            from = from,
+            to = to,
+            target = target,
+            onUpdate = onUpdate,
+            onComplete = onComplete
+        };
+
+        // Show the starting value this frame, as the first pass of a coroutine would
+        if (delay <= 0f && kind != Kind.Delay && duration > 0f)
+            Apply(ref tweens[index], 0f);
+
+        return ((generations[id] & 0x7FFF) << 16) | (id + 1);
+    }
+
+    private void Update()
+    {
+        float now = Time.time;
+        int i = 0;
+        while (i < count)
+        {
+            ref Tween tween = ref tweens[i];
+            if (tween.dead || (tween.kind >= Kind.Position && tween.target == null))
+            {
+                // Killed, or its target was destroyed mid-animation
+                if (!tween.dead)
+                    ReleaseId(tween.id);
+                RemoveAt(i);
+                continue;
+            }
+
+            float elapsed = now - tween.startTime;
+            if (elapsed < 0f)
+            {
+                i++;
+                continue;
+            }
+
+            float t = elapsed * tween.inverseDuration;
+            if (t < 1f)
+            {
+                Apply(ref tween, Evaluate(tween.curve, t));
+                i++;
+                continue;
+            }
+
+            // Finished: land exactly on the end value, then complete after the pass
+            Apply(ref tween, Evaluate(tween.curve, 1f));
+            if (tweens[i].dead)
+            {
+                // Killed by its own onUpdate; the array may also have grown under the ref
+                RemoveAt(i);
+                continue;
+            }
+            Action onComplete = tweens[i].onComplete;
+            if (onComplete != null)
+            {
+                if (completedCount == completed.Length)
+                    Array.Resize(ref completed, completed.Length * 2);
+                completed[completedCount++] = onComplete;
+            }
+            ReleaseId(tweens[i].id);
+            RemoveAt(i);
+        }
+
+        for (int c = 0; c < completedCount; c++)
+        {
+            Action onComplete = completed[c];
+            completed[c] = null;
+            try
+            {
+                onComplete();
+            }
+            catch (Exception e)
+            {
+                Debug.LogException(e);
+            }
+        }
+        completedCount = 0;
+    }
+
+    private static void Apply(ref Tween tween, float t)
+    {
+        switch (tween.kind)
+        {
+            case Kind.Value:
+                if (tween.onUpdate != null)
+                {
+                    try
+                    {
+                        tween.onUpdate(Mathf.LerpUnclamped(tween.from.x, tween.to.x, t));
+                    }
+                    catch (Exception e)
+                    {
+                        Debug.LogException(e);
+                    }
+                }
+                break;
+            case Kind.Position:
+                ((Transform)tween.target).position = Vector3.LerpUnclamped(tween.from, tween.to, t);
+                break;
+            case Kind.LocalPosition:
+                ((Transform)tween.target).localPosition = Vector3.LerpUnclamped(tween.from, tween.to, t);
+                break;
+            case Kind.LocalScale:
+                ((Transform)tween.target).localScale = Vector3.LerpUnclamped(tween.from, tween.to, t);
+                break;
+            case Kind.Alpha:
+                ((CanvasGroup)tween.target).alpha = Mathf.LerpUnclamped(tween.from.x, tween.to.x, t);
+                break;
+        }
+    }
+
+    private float Evaluate(int curve, float t)
+    {
+        if (curve < 0)
+            return t;
+
+        float position = Mathf.Clamp01(t) * CurveSamples;
+        int sample = Mathf.Min((int)position, CurveSamples - 1);
+        return Mathf.LerpUnclamped(curveSamples[curve + sample], curveSamples[curve + sample + 1], position - sample);
+    }
+
+    private int CurveOffset(AnimationCurve curve)
+    {
+        if (curve == null)
+            return -1;
+        if (curveOffsets.TryGetValue(curve, out int offset))
+            return offset;
+
+        offset = curveSampleCount;
+        curveSampleCount += CurveSamples + 1;
+        if (curveSampleCount > curveSamples.Length)
+            Array.Resize(ref curveSamples, Mathf.Max(curveSampleCount, curveSamples.Length * 2));
+        SampleCurve(curve, offset);
+        curveOffsets[curve] = offset;
+        return offset;
+    }
+
+    private void SampleCurve(AnimationCurve curve, int offset)
+    {
+        for (int s = 0; s <= CurveSamples; s++)
+            curveSamples[offset + s] = curve.Evaluate((float)s / CurveSamples);
+    }
+
+    private void ReleaseId(int id)
+    {
+        denseOf[id] = -1;
+        generations[id]++;
+        freeIds.Push(id);
+    }
+
+    private void RemoveAt(int index)
+    {
+        int last = --count;
+        if (index != last)
+        {
+            tweens[index] = tweens[last];
+            if (!tweens[index].dead)
+                denseOf[tweens[index].id] = index;
+        }
+        tweens[last] = default;
+    }
+}